@@ -39,11 +39,13 @@ cbuffer PerMaterialBuffer : register(b1)
 	float3 padding1;
 };
 
+#define MAX_INSTANCES 256 // Must match SHADER_MAX_INSTANCES
+
 cbuffer PerObjectBuffer : register(b2)
 {
-	matrix mWorld;
-    matrix mWorldView;
-    matrix mWorldViewProjection;
+	matrix mView;
+	matrix mViewProjection;
+	matrix mWorldInstances[MAX_INSTANCES]; // A single object is an instance too
 }
 //===========================================
 
@@ -68,14 +70,15 @@ struct PixelOutputType
 };
 //===========================================
 
-PixelInputType DirectusVertexShader(Vertex_PosUvTbn input)
+PixelInputType DirectusVertexShader(Vertex_PosUvTbn input, uint instanceID : SV_InstanceID)
 {
     PixelInputType output;
     
+	matrix mWorld		= mWorldInstances[instanceID];
     input.position.w 	= 1.0f;	
 	output.positionWS 	= mul(input.position, mWorld);
-	output.positionVS 	= mul(input.position, mWorldView);
-	output.positionCS 	= mul(input.position, mWorldViewProjection);	
+	output.positionVS 	= mul(output.positionWS, mView);
+	output.positionCS 	= mul(output.positionWS, mViewProjection);	
 	output.normal 		= normalize(mul(float4(input.normal, 0.0f), mWorld)).xyz;	
 	output.tangent 		= normalize(mul(float4(input.tangent, 0.0f), mWorld)).xyz;
 	output.bitangent 	= normalize(mul(float4(input.bitangent, 0.0f), mWorld)).xyz;
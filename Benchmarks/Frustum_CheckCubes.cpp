@@ -0,0 +1,170 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Compares Frustum::CheckCubes() (scalar, SSE and AVX) against the per box path it replaced,
+// at 10k, 100k and 1M boxes, and checks that all of them agree on what is visible.
+// Built by the "Benchmark_Frustum" project (see Build_Scripts/premake5.lua), it only needs the math sources.
+
+//= INCLUDES ==================
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include "Math/Frustum.h"
+#include "Math/BoundingBox.h"
+#include "Math/Quaternion.h"
+//=============================
+
+//= NAMESPACES =====================
+using namespace std;
+using namespace std::chrono;
+using namespace Directus::Math;
+//==================================
+
+namespace
+{
+	struct Boxes
+	{
+		// As the scene has them (local box and world transform)
+		vector<BoundingBox> local;
+		vector<Matrix> world;
+
+		// As the batch test takes them (world space, SoA)
+		vector<float> centerX, centerY, centerZ;
+		vector<float> extentX, extentY, extentZ;
+	};
+
+	Boxes Boxes_Create(unsigned int count, unsigned int seed)
+	{
+		mt19937 random(seed);
+		uniform_real_distribution<float> position(-500.0f, 500.0f);
+		uniform_real_distribution<float> size(0.2f, 4.0f);
+
+		Boxes boxes;
+		boxes.local.resize(count);
+		boxes.world.resize(count);
+		for (auto* array : { &boxes.centerX, &boxes.centerY, &boxes.centerZ, &boxes.extentX, &boxes.extentY, &boxes.extentZ })
+		{
+			array->resize(count);
+		}
+
+		for (unsigned int i = 0; i < count; i++)
+		{
+			Vector3 extent		= Vector3(size(random), size(random), size(random));
+			boxes.local[i]		= BoundingBox(extent * -1.0f, extent);
+			boxes.world[i]		= Matrix(Vector3(position(random), position(random), position(random)), Quaternion(0, 0, 0, 1), Vector3::One);
+
+			BoundingBox world	= boxes.local[i].Transformed(boxes.world[i]);
+			Vector3 center		= world.GetCenter();
+			Vector3 extents		= world.GetExtents();
+			boxes.centerX[i] = center.x;	boxes.centerY[i] = center.y;	boxes.centerZ[i] = center.z;
+			boxes.extentX[i] = extents.x;	boxes.extentY[i] = extents.y;	boxes.extentZ[i] = extents.z;
+		}
+
+		return boxes;
+	}
+
+	// Average microseconds per pass
+	double Measure(unsigned int passes, const function<void()>& pass)
+	{
+		pass(); // Warm up
+
+		auto start = high_resolution_clock::now();
+		for (unsigned int i = 0; i < passes; i++)
+		{
+			pass();
+		}
+		return duration<double, micro>(high_resolution_clock::now() - start).count() / passes;
+	}
+}
+
+int main()
+{
+	Frustum frustum;
+	Matrix view		= Matrix::CreateLookAtLH(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.3f, 0.1f, 1.0f), Vector3::Up);
+	Matrix projection	= Matrix::CreatePerspectiveFieldOfViewLH(1.0f, 1.78f, 0.3f, 500.0f);
+	frustum.Construct(view, projection, 500.0f);
+
+	printf("%10s %24s %12s %18s %15s %15s\n", "boxes", "Transformed+CheckCube", "CheckCube", "CheckCubes scalar", "CheckCubes SSE", "CheckCubes AVX");
+
+	bool agree = true;
+	for (unsigned int count : { 10000u, 100000u, 1000000u })
+	{
+		Boxes boxes			= Boxes_Create(count, 3);
+		unsigned int passes	= count >= 1000000 ? 5 : 50;
+		unsigned int words	= (count + 31) / 32;
+
+		// The path the batch test replaced, and the same test on boxes which are already in world space
+		vector<unsigned int> visibilityReference(words, 0);
+		double transformed = Measure(passes, [&]()
+		{
+			for (unsigned int i = 0; i < count; i++)
+			{
+				BoundingBox world = boxes.local[i].Transformed(boxes.world[i]);
+				if (frustum.CheckCube(world.GetCenter(), world.GetExtents()) != Outside)
+				{
+					visibilityReference[i >> 5] |= 1u << (i & 31);
+				}
+			}
+		});
+
+		double single = Measure(passes, [&]()
+		{
+			for (unsigned int i = 0; i < count; i++)
+			{
+				Vector3 center	= Vector3(boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i]);
+				Vector3 extent	= Vector3(boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i]);
+				if (frustum.CheckCube(center, extent) != Outside)
+				{
+					visibilityReference[i >> 5] |= 1u << (i & 31);
+				}
+			}
+		});
+
+		double batch[3];
+		Frustum_Batch batches[3] = { Frustum_Batch_Scalar, Frustum_Batch_SSE, Frustum_Batch_AVX };
+		for (unsigned int b = 0; b < 3; b++)
+		{
+			vector<unsigned int> visibility(words, 0);
+			batch[b] = Measure(passes, [&]()
+			{
+				frustum.CheckCubes(
+					boxes.centerX.data(), boxes.centerY.data(), boxes.centerZ.data(),
+					boxes.extentX.data(), boxes.extentY.data(), boxes.extentZ.data(),
+					count, visibility.data(), batches[b]
+				);
+			});
+
+			if (visibility != visibilityReference)
+			{
+				printf("Mismatch: the batch test (path %u) disagrees with CheckCube() at %u boxes\n", b, count);
+				agree = false;
+			}
+		}
+
+		printf("%10u %21.1f us %9.1f us %15.1f us %12.1f us %12.1f us\n", count, transformed, single, batch[0], batch[1], batch[2]);
+	}
+
+	// On a CPU without AVX (or a target without SIMD) the faster paths fall back, they are still compared
+	printf(agree ? "All paths agree on what is visible.\n" : "The paths disagree.\n");
+	return agree ? 0 : 1;
+}
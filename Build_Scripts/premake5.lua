@@ -2,16 +2,19 @@ WIN_SDK_VERSION 	= "10.0.17134.0"
 SOLUTION_NAME 		= "Directus"
 EDITOR_NAME 		= "Editor"
 RUNTIME_NAME 		= "Runtime"
+BENCHMARK_NAME		= "Benchmark_Frustum"
+HEADLESS_NAME		= "Headless"
 EDITOR_DIR			= "../" .. EDITOR_NAME
 RUNTIME_DIR			= "../" .. RUNTIME_NAME
 TARGET_DIR_RELEASE 	= "../Binaries/Release"
 TARGET_DIR_DEBUG 	= "../Binaries/Debug"
+TARGET_DIR_HEADLESS	= "../Binaries/Headless"
 OBJ_DIR 			= "../Binaries/Obj"
 
 -- Solution
 	solution (SOLUTION_NAME)
 		location ".."
-		configurations { "Release", "Debug" }
+		configurations { "Release", "Debug", "Headless" }
 		platforms { "x64" }
 		filter { "platforms:x64" }
 			system "Windows"
@@ -49,6 +52,12 @@ OBJ_DIR 			= "../Binaries/Obj"
 		defines { "NDEBUG", "COMPILING_LIB" }
 		optimize "Full"
 		flags { "MultiProcessorCompile", "LinkTimeOptimization" }
+
+-- Headless configuration (Release with the null RHI, no window or GPU required)
+	filter "configurations:Headless"
+		defines { "NDEBUG", "COMPILING_LIB", "API_NULL" }
+		optimize "Full"
+		flags { "MultiProcessorCompile", "LinkTimeOptimization" }
 		
 -- Solution configuration "Debug"
 	configuration "Debug"
@@ -78,12 +87,27 @@ OBJ_DIR 			= "../Binaries/Obj"
 		links { "pugixml" }
 		links { "IrrXML" }
 
+-- Solution configuration "Headless"
+	configuration "Headless"
+		targetdir (TARGET_DIR_HEADLESS)
+		objdir (OBJ_DIR)
+		debugdir (TARGET_DIR_HEADLESS)
+		links { "angelscript64" }
+		links { "assimp" }
+		links { "fmod64_vc" }
+		links { "FreeImageLib" }
+		links { "freetype" }
+		links { "BulletCollision", "BulletDynamics", "BulletSoftBody", "LinearMath" }
+		links { "pugixml" }
+		links { "IrrXML" }
+
  -- Editor --------------------------------------------------------------------------------------------------
 	project (EDITOR_NAME)
 		location (EDITOR_DIR)
 		kind "WindowedApp"	
 		language "C++"
 		files { "../Editor/**.h", "../Editor/**.cpp", "../Editor/**.hpp", "../Editor/**.inl" }
+		removeconfigurations { "Headless" }
 		links { RUNTIME_NAME }
 		dependson { RUNTIME_NAME }
 		systemversion(WIN_SDK_VERSION)
@@ -116,4 +140,63 @@ OBJ_DIR 			= "../Binaries/Obj"
 	configuration "Release"
 		targetdir (TARGET_DIR_RELEASE)
 		objdir (OBJ_DIR)
-		debugdir (TARGET_DIR_RELEASE)
\ No newline at end of file
+		debugdir (TARGET_DIR_RELEASE)
+
+ -- Benchmarks ----------------------------------------------------------------------------------------------
+	project (BENCHMARK_NAME)
+		location ("../Benchmarks")
+		kind "ConsoleApp"
+		language "C++"
+		files { "../Benchmarks/Frustum_CheckCubes.cpp", "../Runtime/Math/**.h", "../Runtime/Math/**.cpp" }
+		removeconfigurations { "Headless" }
+		systemversion(WIN_SDK_VERSION)
+		cppdialect "C++17"
+
+-- Includes
+	includedirs { "../Runtime" }
+
+-- Debug configuration (the math sources are built in, so they are compiled as the library)
+	filter "configurations:Debug"
+		defines { "DEBUG", "COMPILING_LIB" }
+		symbols "On"
+
+-- Release configuration
+	filter "configurations:Release"
+		defines { "NDEBUG", "COMPILING_LIB" }
+		optimize "Full"
+
+-- Output directories
+	configuration "Debug"
+		targetdir (TARGET_DIR_DEBUG)
+		objdir (OBJ_DIR)
+
+	configuration "Release"
+		targetdir (TARGET_DIR_RELEASE)
+		objdir (OBJ_DIR)
+
+ -- Headless ------------------------------------------------------------------------------------------------
+	project (HEADLESS_NAME)
+		location ("../Headless")
+		kind "ConsoleApp"
+		language "C++"
+		files { "../Headless/**.h", "../Headless/**.cpp" }
+		removeconfigurations { "Release", "Debug" }
+		links { RUNTIME_NAME }
+		dependson { RUNTIME_NAME }
+		systemversion(WIN_SDK_VERSION)
+		cppdialect "C++17"
+
+-- Includes
+	includedirs { "../Runtime" }
+
+-- Headless configuration (the runtime is built with API_NULL in it)
+	filter "configurations:Headless"
+		defines { "NDEBUG", "API_NULL" }
+		optimize "Full"
+		flags { "MultiProcessorCompile" }
+
+-- Output directories
+	configuration "Headless"
+		targetdir (TARGET_DIR_HEADLESS)
+		objdir (OBJ_DIR)
+		debugdir (TARGET_DIR_HEADLESS)
\ No newline at end of file
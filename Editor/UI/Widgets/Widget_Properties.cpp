@@ -51,9 +51,10 @@ using namespace Directus;
 using namespace Math;
 //=======================
 
-static weak_ptr<Actor> g_inspectedActor;
+static ActorHandle g_inspectedActor;
 static weak_ptr<Material> g_inspectedMaterial;
 static ResourceManager* g_resourceManager = nullptr;
+static Scene* g_scene = nullptr;
 
 //= COLOR PICKERS ===============================================
 static unique_ptr<ButtonColorPicker> g_materialButtonColorPicker;
@@ -74,7 +75,7 @@ namespace ComponentProperty
 		{
 			if (ImGui::MenuItem("Remove"))
 			{
-				if (auto actor = Widget_Scene::GetActorSelected().lock())
+				if (auto actor = g_scene->GetActor(Widget_Scene::GetActorSelected()))
 				{
 					if (component)
 					{
@@ -138,16 +139,15 @@ void Widget_Properties::Initialize(Context* context)
 {
 	Widget::Initialize(context);
 	g_resourceManager = context->GetSubsystem<ResourceManager>();
+	g_scene = context->GetSubsystem<Scene>();
 }
 
 void Widget_Properties::Update(float deltaTime)
 {
 	ImGui::PushItemWidth(ComponentProperty::g_maxWidth);
 
-	if (!g_inspectedActor.expired())
+	if (auto actorPtr = g_scene->GetActor(g_inspectedActor))
 	{
-		auto actorPtr = g_inspectedActor.lock().get();
-
 		auto transform		= actorPtr->GetTransform_PtrRaw();
 		auto light			= actorPtr->GetComponent<Light>().lock().get();
 		auto camera			= actorPtr->GetComponent<Camera>().lock().get();
@@ -186,7 +186,7 @@ void Widget_Properties::Update(float deltaTime)
 	ImGui::PopItemWidth();
 }
 
-void Widget_Properties::Inspect(weak_ptr<Actor> actor)
+void Widget_Properties::Inspect(const ActorHandle& actor)
 {
 	g_inspectedActor = actor;
 
@@ -200,7 +200,7 @@ void Widget_Properties::Inspect(weak_ptr<Actor> actor)
 
 void Widget_Properties::Inspect(weak_ptr<Material> material)
 {
-	g_inspectedActor.reset();
+	g_inspectedActor = ActorHandle();
 	g_inspectedMaterial = material;
 }
 
@@ -1042,7 +1042,7 @@ void Widget_Properties::ComponentContextMenu_Add()
 {
 	if (ImGui::BeginPopup("##ComponentContextMenu_Add"))
 	{
-		if (auto actor = Widget_Scene::GetActorSelected().lock())
+		if (auto actor = g_scene->GetActor(Widget_Scene::GetActorSelected()))
 		{
 			// CAMERA
 			if (ImGui::MenuItem("Camera"))
@@ -1112,9 +1112,12 @@ void Widget_Properties::Drop_AutoAddComponents()
 {
 	if (auto payload = DragDrop::Get().GetPayload(DragPayload_Script))
 	{
-		if (auto scriptComponent = g_inspectedActor.lock()->AddComponent<Script>().lock())
+		if (auto actor = g_scene->GetActor(g_inspectedActor))
 		{
-			scriptComponent->SetScript(get<const char*>(payload->data));
+			if (auto scriptComponent = actor->AddComponent<Script>().lock())
+			{
+				scriptComponent->SetScript(get<const char*>(payload->data));
+			}
 		}
 	}
 }
@@ -21,10 +21,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
-//= INCLUDES ======
+//= INCLUDES ==============
 #include "Widget.h"
 #include <memory>
-//=================
+#include "Scene/ActorHandle.h"
+//=========================
 
 namespace Directus
 {
@@ -50,7 +51,7 @@ public:
 	void Initialize(Directus::Context* context) override;
 	void Update(float deltaTime) override;
 
-	static void Inspect(std::weak_ptr<Directus::Actor> actor);
+	static void Inspect(const Directus::ActorHandle& actor);
 	static void Inspect(std::weak_ptr<Directus::Material> material);
 
 private:
@@ -49,8 +49,7 @@ using namespace std;
 using namespace Directus;
 //=======================
 
-weak_ptr<Actor> Widget_Scene::m_actorSelected;
-weak_ptr<Actor> g_actorEmpty;
+ActorHandle Widget_Scene::m_actorSelected;
 
 namespace SceneHelper
 {
@@ -60,7 +59,7 @@ namespace SceneHelper
 	static bool g_popupRenameActor	= false;
 	static DragDropPayload g_payload;
 	static Actor* g_actorHovered = nullptr;
-	static weak_ptr<Actor> g_actorCopied;
+	static ActorHandle g_actorCopied;
 }
 
 Widget_Scene::Widget_Scene()
@@ -90,7 +89,7 @@ void Widget_Scene::Update(float deltaTime)
 	Tree_Show();
 }
 
-void Widget_Scene::SetSelectedActor(weak_ptr<Actor> actor)
+void Widget_Scene::SetSelectedActor(const ActorHandle& actor)
 {
 	m_actorSelected = actor;
 	Widget_Properties::Inspect(m_actorSelected);
@@ -115,7 +114,7 @@ void Widget_Scene::Tree_Show()
 		auto rootActors = SceneHelper::g_scene->GetRootActors();
 		for (const auto& actor : rootActors)
 		{
-			Tree_AddActor(actor.lock().get());
+			Tree_AddActor(SceneHelper::g_scene->GetActor(actor));
 		}
 
 		ImGui::TreePop();
@@ -156,10 +155,7 @@ void Widget_Scene::Tree_AddActor(Actor* actor)
 
 	ImGuiTreeNodeFlags node_flags = ImGuiTreeNodeFlags_AllowItemOverlap;
 	node_flags |= hasVisibleChildren ? ImGuiTreeNodeFlags_OpenOnArrow : ImGuiTreeNodeFlags_Leaf; // Expandable?	
-	if (!m_actorSelected.expired()) // Selected?
-	{
-		node_flags |= (m_actorSelected.lock()->GetID() == actor->GetID()) ? ImGuiTreeNodeFlags_Selected : 0;
-	}
+	node_flags |= (m_actorSelected == actor->GetHandle()) ? ImGuiTreeNodeFlags_Selected : 0; // Selected?
 	bool isNodeOpen = ImGui::TreeNodeEx((void*)(intptr_t)actor->GetID(), node_flags, actor->GetName().c_str());
 
 	// Manually detect some useful states
@@ -198,7 +194,7 @@ void Widget_Scene::HandleClicking()
 	// Left click on item - Select
 	if (ImGui::IsMouseClicked(0) && SceneHelper::g_actorHovered)
 	{
-		SetSelectedActor(SceneHelper::g_actorHovered->GetPtrShared());
+		SetSelectedActor(SceneHelper::g_actorHovered->GetHandle());
 	}
 
 	// Right click on item - Select and show context menu
@@ -206,7 +202,7 @@ void Widget_Scene::HandleClicking()
 	{
 		if (SceneHelper::g_actorHovered)
 		{			
-			SetSelectedActor(SceneHelper::g_actorHovered->GetPtrShared());
+			SetSelectedActor(SceneHelper::g_actorHovered->GetHandle());
 		}
 
 		ImGui::OpenPopup("##HierarchyContextMenu");
@@ -215,7 +211,7 @@ void Widget_Scene::HandleClicking()
 	// Clicking on empty space - Clear selection
 	if ((ImGui::IsMouseClicked(0) || ImGui::IsMouseClicked(1)) && !SceneHelper::g_actorHovered)
 	{
-		SetSelectedActor(g_actorEmpty);
+		SetSelectedActor(ActorHandle());
 	}
 }
 
@@ -254,7 +250,7 @@ void Widget_Scene::Popup_ContextMenu()
 	if (!ImGui::BeginPopup("##HierarchyContextMenu"))
 		return;
 
-	bool onActor = !m_actorSelected.expired();
+	bool onActor = SceneHelper::g_scene->Actor_Exists(m_actorSelected);
 
 	if (onActor) if (ImGui::MenuItem("Copy"))
 	{
@@ -263,7 +259,7 @@ void Widget_Scene::Popup_ContextMenu()
 
 	if (ImGui::MenuItem("Paste"))
 	{
-		if (auto actor = SceneHelper::g_actorCopied.lock())
+		if (auto actor = SceneHelper::g_scene->GetActor(SceneHelper::g_actorCopied))
 		{
 			actor->Clone();
 		}
@@ -385,7 +381,7 @@ void Widget_Scene::Popup_ActorRename()
 
 	if (ImGui::BeginPopup("##RenameActor"))
 	{
-		auto actor = m_actorSelected.lock();
+		auto actor = SceneHelper::g_scene->GetActor(m_actorSelected);
 		if (!actor)
 		{
 			ImGui::CloseCurrentPopup();
@@ -419,15 +415,18 @@ void Widget_Scene::HandleKeyShortcuts()
 	}
 }
 
-void Widget_Scene::Action_Actor_Delete(weak_ptr<Actor> actor)
+void Widget_Scene::Action_Actor_Delete(const ActorHandle& actor)
 {
-	SceneHelper::g_scene->Actor_Remove(actor);
+	if (auto actorPtr = SceneHelper::g_scene->GetActor(actor))
+	{
+		SceneHelper::g_scene->Actor_Remove(actorPtr->GetPtrShared());
+	}
 }
 
 Actor* Widget_Scene::Action_Actor_CreateEmpty()
 {
 	auto actor = SceneHelper::g_scene->Actor_CreateAdd().lock().get();
-	if (auto selected = m_actorSelected.lock())
+	if (auto selected = SceneHelper::g_scene->GetActor(m_actorSelected))
 	{
 		actor->GetTransform_PtrRaw()->SetParent(selected->GetTransform_PtrRaw());
 	}
@@ -21,10 +21,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
-//= INCLUDES ======
+//= INCLUDES ==============
 #include "Widget.h"
 #include <memory>
-//=================
+#include "Scene/ActorHandle.h"
+//=========================
 
 namespace Directus { class Actor; }
 
@@ -35,8 +36,8 @@ public:
 	void Initialize(Directus::Context* context) override;
 	void Update(float deltaTime) override;
 
-	static std::weak_ptr<Directus::Actor> GetActorSelected() { return m_actorSelected; }
-	static void SetSelectedActor(std::weak_ptr<Directus::Actor> actor) ;
+	static const Directus::ActorHandle& GetActorSelected() { return m_actorSelected; }
+	static void SetSelectedActor(const Directus::ActorHandle& actor);
 
 private:
 	// Tree
@@ -54,7 +55,7 @@ private:
 	void HandleKeyShortcuts();
 
 	// Context menu actions
-	void Action_Actor_Delete(std::weak_ptr<Directus::Actor> actor);
+	void Action_Actor_Delete(const Directus::ActorHandle& actor);
 	Directus::Actor* Action_Actor_CreateEmpty();
 	void Action_Actor_CreateCube();
 	void Action_Actor_CreateQuad();
@@ -71,5 +72,5 @@ private:
 	void Action_actor_CreateAudioSource();
 	void Action_actor_CreateAudioListener();
 	
-	static std::weak_ptr<Directus::Actor> m_actorSelected;
+	static Directus::ActorHandle m_actorSelected;
 };
@@ -118,17 +118,17 @@ void Widget_Viewport::MousePicking()
 	if (!ImGui::IsMouseHoveringWindow() || !ImGui::IsMouseClicked(0))
 		return;
 
-	auto camera = Widget_Viewport_Properties::g_scene->GetMainCamera();
-	if (!camera.expired())
+	auto scene = Widget_Viewport_Properties::g_scene;
+	if (auto camera = scene->GetActor(scene->GetMainCamera()))
 	{
 		Vector2 mousePosRelative = EditorHelper::ToVector2(ImGui::GetMousePos()) - Widget_Viewport_Properties::g_framePos;
-		auto picked = camera.lock()->GetComponent<Camera>().lock()->Pick(mousePosRelative);
-		if (!picked.expired())
+		auto picked = camera->GetComponent<Camera>().lock()->Pick(mousePosRelative);
+		if (!picked.IsNull())
 		{
 			Widget_Scene::SetSelectedActor(picked);
 			return;
 		}
 	}
 
-	Widget_Scene::SetSelectedActor(weak_ptr<Actor>());
+	Widget_Scene::SetSelectedActor(ActorHandle());
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Runs the engine without a window (e.g. on build agents), built with API_NULL by the "Headless" configuration.
+// Usage: Headless [scene file] [frames]
+
+//= INCLUDES ==============
+#include <memory>
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "Core/Engine.h"
+#include "Core/Context.h"
+#include "Scene/Scene.h"
+//=========================
+
+//= NAMESPACES ==========
+using namespace std;
+using namespace std::chrono;
+using namespace Directus;
+//=======================
+
+int main(int argc, char* argv[])
+{
+	string scenePath	= argc > 1 ? argv[1] : "";
+	int frames			= argc > 2 ? atoi(argv[2]) : 1000;
+
+	// No window, so there is nothing to draw to or to read input from
+	Engine::SetHandles(nullptr, nullptr, nullptr);
+	auto engine = make_unique<Engine>(new Context);
+	if (!engine->Initialize())
+	{
+		printf("Headless: Failed to initialize the engine, see the log\n");
+		return 1;
+	}
+
+	if (!scenePath.empty() && !engine->GetContext()->GetSubsystem<Scene>()->LoadFromFile(scenePath))
+	{
+		printf("Headless: Failed to load \"%s\"\n", scenePath.c_str());
+		return 1;
+	}
+
+	// Tick (the frame rate is capped by the settings, as it is in the editor)
+	auto start = high_resolution_clock::now();
+	for (int i = 0; i < frames; i++)
+	{
+		engine->Tick();
+	}
+	double elapsed = duration<double, milli>(high_resolution_clock::now() - start).count();
+
+	printf("Headless: %d frames in %.1f ms (%.3f ms per frame)\n", frames, elapsed, frames > 0 ? elapsed / frames : 0.0);
+
+	engine->Shutdown();
+	engine.release();
+
+	return 0;
+}
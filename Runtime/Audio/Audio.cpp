@@ -47,9 +47,6 @@ namespace Directus
 		m_distanceFactor	= 1.0f;
 		m_initialized		= false;
 		m_listener			= nullptr;
-
-		// Subscribe to update event
-		SUBSCRIBE_TO_EVENT(EVENT_UPDATE, EVENT_HANDLER(Update));
 	}
 
 	Audio::~Audio()
@@ -76,7 +76,7 @@ namespace Directus
 		return m_playMode == Play_Memory ? CreateSound(filePath) : CreateStream(filePath);
 	}
 
-	unsigned int AudioClip::GetMemory()
+	unsigned long long AudioClip::GetMemory()
 	{
 		return 0; // have to find a way to get that
 	}
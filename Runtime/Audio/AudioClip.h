@@ -60,7 +60,7 @@ namespace Directus
 		//= IResource ==========================================================
 		bool LoadFromFile(const std::string& filePath) override;
 		bool SaveToFile(const std::string& filePath) override { return true; }
-		unsigned int GetMemory() override;
+		unsigned long long GetMemory() override;
 		//======================================================================
 
 		bool Play();
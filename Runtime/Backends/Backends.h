@@ -22,7 +22,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 //= RENDERING ======
+// API_NULL (headless) is defined by the build, see the "Headless" configuration
+#ifndef API_NULL
 #define API_D3D11
+#endif
 //#define API_VULKAN
 //==================
 
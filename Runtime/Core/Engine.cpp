@@ -23,7 +23,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Engine.h"
 #include "Timer.h"
 #include "Settings.h"
-#include "Stopwatch.h"
 #include "../Input/Input_Definition.h"
 #include "../Input/Input_Implementation.h"
 #include "../Rendering/Renderer.h"
@@ -32,11 +31,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/EventSystem.h"
 #include "../Logging/Log.h"
 #include "../Threading/Threading.h"
+#include "../Threading/TaskGraph.h"
 #include "../Resource/ResourceManager.h"
 #include "../Scripting/Scripting.h"
 #include "../Audio/Audio.h"
 #include "../Physics/Physics.h"
 #include "../Scene/Scene.h"
+#include "../Scene/TransformStore.h"
 #include "../Profiling/Profiler.h"
 //========================================
 
@@ -50,7 +51,6 @@ namespace Directus
 	void* Engine::m_windowHandle	= nullptr;
 	void* Engine::m_windowInstance	= nullptr;
 	unsigned long Engine::m_flags	= 0;
-	static unique_ptr<Stopwatch> g_stopwatch;
 
 	Engine::Engine(Context* context) : Subsystem(context)
 	{
@@ -60,7 +60,8 @@ namespace Directus
 		m_flags |= Engine_Game;
 
 		m_timer			= nullptr;
-		g_stopwatch		= make_unique<Stopwatch>();
+		m_taskGraph		= nullptr;
+		m_taskGraphPipelined = false;
 
 		// Register self as a subsystem
 		m_context->RegisterSubsystem(this);
@@ -93,8 +94,8 @@ namespace Directus
 			return false;
 		}
 	
-		// Input
-		if (!m_context->GetSubsystem<Input>()->Initialize())
+		// Input (optional when running headless, without a window)
+		if (!m_context->GetSubsystem<Input>()->Initialize() && m_windowHandle)
 		{
 			LOG_ERROR("Engine::Initialize: Failed to initialize Input");
 			return false;
@@ -158,37 +159,37 @@ namespace Directus
 		}
 
 		Profiler::Get().Initialize(m_context);
-		g_stopwatch->Start();
+		TaskGraph_Create();
 
 		return true;
 	}
 
 	void Engine::Tick()
 	{
-		//= MAX FPS =======================================================================
+		// Wait for the next frame, without burning a core while doing so
 		float maxFPS = EngineMode_IsSet(Engine_Game) ? Settings::Get().GetMaxFPS() : 60.0f;
-		if (g_stopwatch->GetElapsedTimeSec() < 1.0 / maxFPS)
-		{
-			return;
-		}
-		g_stopwatch->Start();
-		//=================================================================================
+		m_timer->Pace(maxFPS);
 		
-		m_timer->Tick();
-
-		if (EngineMode_IsSet(Engine_Update))
+		// Switching between pipelined and serial frames changes the stages and their dependencies
+		if (EngineMode_IsSet(Engine_Pipelined) != m_taskGraphPipelined)
 		{
-			FIRE_EVENT_DATA(EVENT_UPDATE, m_timer->GetDeltaTimeSec());
+			TaskGraph_Create();
 		}
 
-		if (EngineMode_IsSet(Engine_Render))
+		m_timer->Tick();
+		m_taskGraph->Execute();
+
+		// What was captured this frame gets rendered next frame
+		if (m_taskGraphPipelined)
 		{
-			FIRE_EVENT(EVENT_RENDER);
+			m_context->GetSubsystem<Renderer>()->Snapshot_Swap();
 		}
 	}
 
 	void Engine::Shutdown()
 	{
+		SafeDelete(m_taskGraph);
+
 		// The context will deallocate the subsystems
 		// in the reverse order in which they were registered.
 		SafeDelete(m_context);
@@ -208,4 +209,100 @@ namespace Directus
 	{
 		return m_timer->GetDeltaTimeSec();
 	}
+
+	void Engine::TaskGraph_Create()
+	{
+		auto threading	= m_context->GetSubsystem<Threading>();
+		auto input		= m_context->GetSubsystem<Input>();
+		auto physics	= m_context->GetSubsystem<Physics>();
+		auto scene		= m_context->GetSubsystem<Scene>();
+		auto audio		= m_context->GetSubsystem<Audio>();
+		auto renderer	= m_context->GetSubsystem<Renderer>();
+		auto resources	= m_context->GetSubsystem<ResourceManager>();
+		auto timer		= m_timer;
+		bool pipelined	= EngineMode_IsSet(Engine_Pipelined);
+
+		if (!m_taskGraph)
+		{
+			m_taskGraph = new TaskGraph(threading);
+		}
+		m_taskGraph->Clear();
+		m_taskGraphPipelined = pipelined;
+
+		// Stages are ordered only where their data overlaps, e.g. physics -> scene (transforms) -> snapshot -> rendering.
+		// Audio and the profiler only read what the scene wrote, so they run alongside the snapshot capture.
+		m_taskGraph->AddStage("Input", 0, FrameData_Input, true, [input]()
+		{
+			if (EngineMode_IsSet(Engine_Update)) input->Update();
+		});
+
+		// When pipelined, the renderer draws the snapshot of the previous frame, which nothing in this frame writes,
+		// so it runs on this thread while the workers simulate. The profiler has to wait for its counters though.
+		if (pipelined)
+		{
+			m_taskGraph->AddStage("Render", 0, FrameData_RenderStats, true, [renderer]()
+			{
+				if (EngineMode_IsSet(Engine_Render)) renderer->Render();
+			});
+		}
+
+		// Completion callbacks of asynchronous loads might touch the scene, so they run before it updates
+		m_taskGraph->AddStage("Resources", 0, FrameData_Scene | FrameData_Transforms, true, [resources]()
+		{
+			resources->Update();
+		});
+
+		m_taskGraph->AddStage("Physics", 0, FrameData_Physics | FrameData_Transforms, false, [physics, timer]()
+		{
+			if (EngineMode_IsSet(Engine_Update)) physics->Step(timer->GetFixedDeltaTimeSec() * timer->GetFixedSteps());
+		});
+
+		m_taskGraph->AddStage("Scene", FrameData_Input | FrameData_Physics, FrameData_Transforms | FrameData_Scene, false, [scene]()
+		{
+			// A load is building the scene on another thread, touching it now would race the loader
+			auto loading = scene->Loading_TryLock();
+			if (!loading)
+				return;
+
+			if (EngineMode_IsSet(Engine_Update)) scene->Update();
+
+			// The editor moves and creates actors even when the simulation is paused
+			scene->GetTransformStore()->Update();
+			scene->SpatialIndex_Update();
+			scene->Resolve();
+		});
+
+		m_taskGraph->AddStage("Audio", FrameData_Transforms, FrameData_Audio, false, [audio]()
+		{
+			if (EngineMode_IsSet(Engine_Update)) audio->Update();
+		});
+
+		m_taskGraph->AddStage("Snapshot", FrameData_Physics | FrameData_Transforms | FrameData_Scene, FrameData_Snapshot, false, [renderer, scene, pipelined]()
+		{
+			if (!EngineMode_IsSet(Engine_Render))
+				return;
+
+			// Same as the scene stage, a half built scene isn't captured (the previous snapshot is kept)
+			auto loading = scene->Loading_TryLock();
+			if (!loading)
+				return;
+
+			renderer->Snapshot_Capture();
+			if (!pipelined) renderer->Snapshot_Swap();
+		});
+
+		m_taskGraph->AddStage("Profiler", FrameData_Scene | FrameData_RenderStats, FrameData_Metrics, false, []()
+		{
+			if (EngineMode_IsSet(Engine_Update)) Profiler::Get().UpdateMetrics();
+		});
+
+		// The renderer uses the immediate device context, so it has to stay on this thread
+		if (!pipelined)
+		{
+			m_taskGraph->AddStage("Render", FrameData_Snapshot | FrameData_Metrics, FrameData_RenderStats, true, [renderer]()
+			{
+				if (EngineMode_IsSet(Engine_Render)) renderer->Render();
+			});
+		}
+	}
 }
\ No newline at end of file
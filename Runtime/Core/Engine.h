@@ -28,9 +28,24 @@ namespace Directus
 		Engine_Physics	= 1UL << 1, // Should physics update?	
 		Engine_Render	= 1UL << 2,	// Should the engine render?
 		Engine_Game		= 1UL << 3,	// Is the engine running in game or editor mode?
+		Engine_Pipelined	= 1UL << 4,	// Should a frame be rendered while the next one is simulated? (adds a frame of latency)
+	};
+
+	// Data that the stages of a frame read and/or write, used to order them in the task graph
+	enum Frame_Data : unsigned long
+	{
+		FrameData_Input			= 1UL << 0,	// Keyboard & mouse state
+		FrameData_Physics		= 1UL << 1,	// Physics world
+		FrameData_Transforms	= 1UL << 2,	// Actor transforms
+		FrameData_Scene			= 1UL << 3,	// Actors, components and the renderable lists
+		FrameData_Audio			= 1UL << 4,	// Audio system
+		FrameData_Metrics		= 1UL << 5,	// Profiler metrics
+		FrameData_RenderStats	= 1UL << 6,	// Profiler counters which are written by the renderer
+		FrameData_Snapshot		= 1UL << 7,	// The render snapshot which is being captured
 	};
 
 	class Timer;
+	class TaskGraph;
 
 	class ENGINE_CLASS Engine : public Subsystem
 	{
@@ -70,14 +85,21 @@ namespace Directus
 
 		float GetDeltaTime();
 
+		// Returns the task graph that executes the stages of a frame
+		TaskGraph* GetTaskGraph() { return m_taskGraph; }
+
 		// Returns the engine's context
 		Context* GetContext() { return m_context; }
 
 	private:
+		void TaskGraph_Create();
+
 		static void* m_drawHandle;	
 		static void* m_windowHandle;
 		static void* m_windowInstance;
 		static unsigned long m_flags;
 		Timer* m_timer;
+		TaskGraph* m_taskGraph;
+		bool m_taskGraphPipelined;
 	};
 }
\ No newline at end of file
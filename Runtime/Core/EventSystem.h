@@ -38,8 +38,6 @@ To fire an event with data			-> FIRE_EVENT_DATA(EVENT_ID, Variant)
 */
 
 //= EVENTS ===============================================================================
-#define EVENT_UPDATE			0	// Fired when the most engine subsystems should update
-#define EVENT_RENDER			1	// Fired when the Renderer should start rendering
 #define EVENT_SCENE_SAVED		2	// Fired when the Scene finished saving to file
 #define EVENT_SCENE_LOADED		3	// Fired when the Scene finished loading from file
 #define EVENT_SCENE_CLEARED		5	// Fired when the Scene should clear everything
@@ -21,25 +21,122 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES =====
 #include "Timer.h"
+#include <thread>
+#include <cmath>
+#ifdef _WIN32
+#include <Windows.h>
+#include <timeapi.h>
+#endif
 //================
 
+#ifdef _WIN32
+#pragma comment(lib, "winmm.lib")
+#endif
+
 //= NAMESPACES ========
 using namespace std;
 using namespace chrono;
 //=====================
 
+// A long frame (e.g. a hitch or a breakpoint) must not make the simulation catch up forever
+static const unsigned int FIXED_STEPS_MAX = 8;
+
 namespace Directus
 {
 	Timer::Timer(Context* context) : Subsystem(context)
 	{
-		m_deltaTimeSec	= 0.0f;
-		m_deltaTimeMs	= 0.0f;
-		m_firstRun		= true;
+		m_deltaTimeSec			= 0.0f;
+		m_deltaTimeMs			= 0.0f;
+		m_firstRun				= true;
+		m_fixedDeltaTimeSec		= 1.0f / 60.0f;
+		m_fixedAccumulatorSec	= 0.0;
+		m_fixedSteps			= 0;
+		m_frameStart			= high_resolution_clock::now();
+		m_sleepEstimateMs		= 5.0;
+		m_sleepMeanMs			= 5.0;
+		m_sleepM2				= 0.0;
+		m_sleepCount			= 1;
+		m_timerResolutionRaised	= false;
 	}
 
 	Timer::~Timer()
 	{
+#ifdef _WIN32
+		if (m_timerResolutionRaised)
+		{
+			timeEndPeriod(1);
+		}
+#endif
+	}
+
+	void Timer::Pace(float targetFPS)
+	{
+		if (targetFPS <= 0.0f)
+		{
+#ifdef _WIN32
+			if (m_timerResolutionRaised)
+			{
+				timeEndPeriod(1);
+				m_timerResolutionRaised = false;
+			}
+#endif
+
+			m_frameStart = high_resolution_clock::now();
+			return;
+		}
+
+#ifdef _WIN32
+		// The default resolution (~15.6ms) would make every sleep overshoot a 60Hz+ frame, leaving nothing but spinning
+		if (!m_timerResolutionRaised && timeBeginPeriod(1) == TIMERR_NOERROR)
+		{
+			m_timerResolutionRaised = true;
+
+			// What was measured so far doesn't apply anymore
+			m_sleepEstimateMs	= 1.0;
+			m_sleepMeanMs		= 1.0;
+			m_sleepM2			= 0.0;
+			m_sleepCount		= 1;
+		}
+#endif
 
+		auto period = duration_cast<high_resolution_clock::duration>(duration<double>(1.0 / targetFPS));
+		auto target = m_frameStart + period;
+
+		// Sleep in 1ms slices for as long as a slice is expected to fit. How long a slice actually
+		// takes depends on the OS scheduler, so it's measured and the estimate is mean + standard deviation.
+		while (true)
+		{
+			auto now = high_resolution_clock::now();
+			if (duration<double, milli>(target - now).count() <= m_sleepEstimateMs)
+				break;
+
+			this_thread::sleep_for(milliseconds(1));
+			double observedMs = duration<double, milli>(high_resolution_clock::now() - now).count();
+
+			// Welford's online variance
+			m_sleepCount++;
+			double delta	= observedMs - m_sleepMeanMs;
+			m_sleepMeanMs	+= delta / m_sleepCount;
+			m_sleepM2		+= delta * (observedMs - m_sleepMeanMs);
+			m_sleepEstimateMs = m_sleepMeanMs + sqrt(m_sleepM2 / (m_sleepCount - 1));
+
+			// Keep adapting (e.g. when the OS timer resolution changes)
+			if (m_sleepCount > 1000)
+			{
+				m_sleepCount	= 1;
+				m_sleepM2		= 0.0;
+			}
+		}
+
+		// Spin for the last slice
+		while (high_resolution_clock::now() < target)
+		{
+			this_thread::yield();
+		}
+
+		// Keep the cadence, unless we have fallen behind by more than a frame
+		auto now		= high_resolution_clock::now();
+		m_frameStart	= (now - target) < period ? target : now;
 	}
 
 	void Timer::Tick()
@@ -57,5 +154,16 @@ namespace Directus
 			m_deltaTimeSec = 0.0f;
 			m_firstRun = false;
 		}
+
+		// Fixed timestep accumulator
+		m_fixedAccumulatorSec	+= m_deltaTimeSec;
+		m_fixedSteps			= (unsigned int)(m_fixedAccumulatorSec / m_fixedDeltaTimeSec);
+		if (m_fixedSteps > FIXED_STEPS_MAX)
+		{
+			// Drop the time we can't catch up with
+			m_fixedSteps			= FIXED_STEPS_MAX;
+			m_fixedAccumulatorSec	= m_fixedSteps * (double)m_fixedDeltaTimeSec;
+		}
+		m_fixedAccumulatorSec -= m_fixedSteps * (double)m_fixedDeltaTimeSec;
 	}
 }
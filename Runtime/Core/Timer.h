@@ -34,14 +34,37 @@ namespace Directus
 		Timer(Context* context);
 		~Timer();
 
+		// Blocks until a frame of the given rate has passed since the previous one (sleeps for most of it, spins for the rest)
+		void Pace(float targetFPS);
 		void Tick();
 		float GetDeltaTimeMs() { return m_deltaTimeMs; }
 		float GetDeltaTimeSec() { return m_deltaTimeSec; }
 
+		//= FIXED TIMESTEP ==================================================================
+		// The simulation advances in whole fixed steps, the remainder carries over to the next frame
+		void SetFixedDeltaTimeSec(float fixedDeltaTime)	{ m_fixedDeltaTimeSec = fixedDeltaTime; }
+		float GetFixedDeltaTimeSec()					{ return m_fixedDeltaTimeSec; }
+		// Returns how many fixed steps the simulation should advance this frame
+		unsigned int GetFixedSteps()					{ return m_fixedSteps; }
+		//===================================================================================
+
 	private:
 		float m_deltaTimeMs;
 		float m_deltaTimeSec;
 		bool m_firstRun;
 		std::chrono::high_resolution_clock::time_point m_previousTime;
+
+		// Fixed timestep
+		float m_fixedDeltaTimeSec;
+		double m_fixedAccumulatorSec;
+		unsigned int m_fixedSteps;
+
+		// Frame pacing
+		std::chrono::high_resolution_clock::time_point m_frameStart;
+		double m_sleepEstimateMs;
+		double m_sleepMeanMs;
+		double m_sleepM2;
+		unsigned int m_sleepCount;
+		bool m_timerResolutionRaised; // Windows: the OS timer runs at 1ms while pacing, otherwise a sleep can take a whole frame
 	};
 }
\ No newline at end of file
@@ -124,6 +124,9 @@ namespace Directus
 			Read(&value);
 			return value;
 		}
+
+		// Moves past data without reading it
+		void Skip(unsigned int bytes) { in.seekg(bytes, std::ios::cur); }
 		//==========================================================
 
 	private:
@@ -47,8 +47,6 @@ namespace Directus
 		g_directInput	= nullptr;
 		g_keyboard		= nullptr;
 		g_mouse			= nullptr;
-
-		SUBSCRIBE_TO_EVENT(EVENT_UPDATE, EVENT_HANDLER(Update));
 	}
 
 	DInput::~DInput()
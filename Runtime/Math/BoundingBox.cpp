@@ -42,13 +42,19 @@ namespace Directus::Math
 		this->m_max = max;
 	}
 
-	BoundingBox::BoundingBox(const std::vector<RHI_Vertex_PosUVTBN>& vertices)
+	BoundingBox::BoundingBox(const std::vector<RHI_Vertex_PosUVTBN>& vertices) : BoundingBox(vertices.data(), (unsigned int)vertices.size())
+	{
+
+	}
+
+	BoundingBox::BoundingBox(const RHI_Vertex_PosUVTBN* vertices, unsigned int vertexCount)
 	{
 		m_min = Vector3::Infinity;
 		m_max = Vector3::InfinityNeg;
 
-		for (const auto& vertex : vertices)
+		for (unsigned int i = 0; i < vertexCount; i++)
 		{
+			const auto& vertex = vertices[i];
 			m_max.x = Max(m_max.x, vertex.pos[0]);
 			m_max.y = Max(m_max.y, vertex.pos[1]);
 			m_max.z = Max(m_max.z, vertex.pos[2]);
@@ -94,7 +100,7 @@ namespace Directus::Math
 		}
 	}
 
-	BoundingBox BoundingBox::Transformed(const Matrix& transform)
+	BoundingBox BoundingBox::Transformed(const Matrix& transform) const
 	{
 		Vector3 newCenter = transform * GetCenter();
 		Vector3 oldEdge = GetSize() * 0.5f;
@@ -47,6 +47,9 @@ namespace Directus
 			// Construct from vertices
 			BoundingBox(const std::vector<RHI_Vertex_PosUVTBN>& vertices);
 
+			// Construct from a range of vertices
+			BoundingBox(const RHI_Vertex_PosUVTBN* vertices, unsigned int vertexCount);
+
 			~BoundingBox() {}
 
 			// Assign from bounding box
@@ -73,7 +76,7 @@ namespace Directus
 			Intersection IsInside (const BoundingBox& box) const;
 
 			// Returns a transformed bounding box
-			BoundingBox Transformed(const Matrix& transform);
+			BoundingBox Transformed(const Matrix& transform) const;
 
 			// Merge with another bounding box
 			void Merge(const BoundingBox& box);
@@ -21,10 +21,139 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES =======
 #include "Frustum.h"
+#include <cstring>
 //==================
 
+// SSE is always there on x64, AVX has to be checked for at runtime
+#if defined(_M_X64) || defined(__x86_64__)
+	#define FRUSTUM_SIMD
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define FRUSTUM_TARGET_AVX
+	#else
+		#define FRUSTUM_TARGET_AVX __attribute__((target("avx")))
+	#endif
+#endif
+
 namespace Directus::Math
 {
+	namespace
+	{
+		// The planes of a frustum, laid out for the batch tests
+		struct PlanesSoA
+		{
+			float x[6], y[6], z[6];			// Normal
+			float absX[6], absY[6], absZ[6];	// Absolute normal
+			float dNeg[6];					// Negated distance
+		};
+
+		inline bool IsVisible(const PlanesSoA& planes, float cx, float cy, float cz, float ex, float ey, float ez)
+		{
+			for (int i = 0; i < 6; i++)
+			{
+				float d = cx * planes.x[i] + cy * planes.y[i] + cz * planes.z[i];
+				float r = ex * planes.absX[i] + ey * planes.absY[i] + ez * planes.absZ[i];
+				if (d + r < planes.dNeg[i])
+					return false;
+			}
+
+			return true;
+		}
+
+#if defined(FRUSTUM_SIMD)
+		bool HasAVX()
+		{
+#if defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 1);
+			bool osSupport	= (info[2] & (1 << 27)) != 0; // OSXSAVE
+			bool cpuSupport	= (info[2] & (1 << 28)) != 0;
+			return osSupport && cpuSupport && (_xgetbv(0) & 0x6) == 0x6;
+#else
+			return __builtin_cpu_supports("avx");
+#endif
+		}
+		const bool g_hasAVX = HasAVX();
+
+		// Returns how many boxes were tested (a multiple of 8), the rest is left to the caller
+		FRUSTUM_TARGET_AVX unsigned int CheckCubes_AVX(const PlanesSoA& planes, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez, unsigned int count, unsigned int* visibility)
+		{
+			unsigned int i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 centerX	= _mm256_loadu_ps(cx + i);
+				__m256 centerY	= _mm256_loadu_ps(cy + i);
+				__m256 centerZ	= _mm256_loadu_ps(cz + i);
+				__m256 extentX	= _mm256_loadu_ps(ex + i);
+				__m256 extentY	= _mm256_loadu_ps(ey + i);
+				__m256 extentZ	= _mm256_loadu_ps(ez + i);
+				__m256 outside	= _mm256_setzero_ps();
+
+				for (int p = 0; p < 6; p++)
+				{
+					__m256 d = _mm256_add_ps(_mm256_add_ps(
+						_mm256_mul_ps(centerX, _mm256_set1_ps(planes.x[p])),
+						_mm256_mul_ps(centerY, _mm256_set1_ps(planes.y[p]))),
+						_mm256_mul_ps(centerZ, _mm256_set1_ps(planes.z[p])));
+					__m256 r = _mm256_add_ps(_mm256_add_ps(
+						_mm256_mul_ps(extentX, _mm256_set1_ps(planes.absX[p])),
+						_mm256_mul_ps(extentY, _mm256_set1_ps(planes.absY[p]))),
+						_mm256_mul_ps(extentZ, _mm256_set1_ps(planes.absZ[p])));
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(d, r), _mm256_set1_ps(planes.dNeg[p]), _CMP_LT_OQ));
+
+					// All eight are out already
+					if (_mm256_movemask_ps(outside) == 0xFF)
+						break;
+				}
+
+				unsigned int mask = ~(unsigned int)_mm256_movemask_ps(outside) & 0xFF;
+				visibility[i >> 5] |= mask << (i & 31);
+			}
+
+			return i;
+		}
+
+		// Returns how many boxes were tested (a multiple of 4), the rest is left to the caller
+		unsigned int CheckCubes_SSE(const PlanesSoA& planes, const float* cx, const float* cy, const float* cz, const float* ex, const float* ey, const float* ez, unsigned int count, unsigned int* visibility)
+		{
+			unsigned int i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 centerX	= _mm_loadu_ps(cx + i);
+				__m128 centerY	= _mm_loadu_ps(cy + i);
+				__m128 centerZ	= _mm_loadu_ps(cz + i);
+				__m128 extentX	= _mm_loadu_ps(ex + i);
+				__m128 extentY	= _mm_loadu_ps(ey + i);
+				__m128 extentZ	= _mm_loadu_ps(ez + i);
+				__m128 outside	= _mm_setzero_ps();
+
+				for (int p = 0; p < 6; p++)
+				{
+					__m128 d = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(centerX, _mm_set1_ps(planes.x[p])),
+						_mm_mul_ps(centerY, _mm_set1_ps(planes.y[p]))),
+						_mm_mul_ps(centerZ, _mm_set1_ps(planes.z[p])));
+					__m128 r = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(extentX, _mm_set1_ps(planes.absX[p])),
+						_mm_mul_ps(extentY, _mm_set1_ps(planes.absY[p]))),
+						_mm_mul_ps(extentZ, _mm_set1_ps(planes.absZ[p])));
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), _mm_set1_ps(planes.dNeg[p])));
+
+					// All four are out already
+					if (_mm_movemask_ps(outside) == 0xF)
+						break;
+				}
+
+				unsigned int mask = ~(unsigned int)_mm_movemask_ps(outside) & 0xF;
+				visibility[i >> 5] |= mask << (i & 31);
+			}
+
+			return i;
+		}
+#endif
+	}
+
 	Frustum::Frustum()
 	{
 
@@ -85,7 +214,7 @@ namespace Directus::Math
 		m_planes[5].Normalize();
 	}
 
-	Intersection Frustum::CheckCube(const Vector3& center, const Vector3& extent)
+	Intersection Frustum::CheckCube(const Vector3& center, const Vector3& extent) const
 	{
 		// Check if any one point of the cube is in the view frustum.
 		Intersection result = Inside;
@@ -114,7 +243,7 @@ namespace Directus::Math
 		return result;
 	}
 
-	Intersection Frustum::CheckSphere(const Vector3& center, float radius)
+	Intersection Frustum::CheckSphere(const Vector3& center, float radius) const
 	{
 		// calculate our distances to each of the planes
 		for (const auto& plane : m_planes)
@@ -138,4 +267,47 @@ namespace Directus::Math
 		// otherwise we are fully in view
 		return Inside;
 	}
-}
\ No newline at end of file
+
+	void Frustum::CheckCubes(
+		const float* centerX, const float* centerY, const float* centerZ,
+		const float* extentX, const float* extentY, const float* extentZ,
+		unsigned int count,
+		unsigned int* visibility,
+		Frustum_Batch batch /*= Frustum_Batch_Auto*/
+	) const
+	{
+		memset(visibility, 0, ((count + 31) / 32) * sizeof(unsigned int));
+
+		PlanesSoA planes;
+		for (int i = 0; i < 6; i++)
+		{
+			planes.x[i]		= m_planes[i].normal.x;
+			planes.y[i]		= m_planes[i].normal.y;
+			planes.z[i]		= m_planes[i].normal.z;
+			planes.absX[i]	= Abs(m_planes[i].normal.x);
+			planes.absY[i]	= Abs(m_planes[i].normal.y);
+			planes.absZ[i]	= Abs(m_planes[i].normal.z);
+			planes.dNeg[i]	= -m_planes[i].d;
+		}
+
+		unsigned int i = 0;
+#if defined(FRUSTUM_SIMD)
+		if (batch != Frustum_Batch_Scalar)
+		{
+			bool avx = g_hasAVX && (batch == Frustum_Batch_Auto || batch == Frustum_Batch_AVX);
+			i = avx ?
+				CheckCubes_AVX(planes, centerX, centerY, centerZ, extentX, extentY, extentZ, count, visibility) :
+				CheckCubes_SSE(planes, centerX, centerY, centerZ, extentX, extentY, extentZ, count, visibility);
+		}
+#endif
+
+		// Whatever doesn't fill a whole register (or everything, without SIMD)
+		for (; i < count; i++)
+		{
+			if (IsVisible(planes, centerX[i], centerY[i], centerZ[i], extentX[i], extentY[i], extentZ[i]))
+			{
+				visibility[i >> 5] |= 1u << (i & 31);
+			}
+		}
+	}
+}
@@ -29,6 +29,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace Directus::Math
 {
+	// Which instructions Frustum::CheckCubes() uses, anything but auto is meant for benchmarks and tests.
+	// A set the CPU doesn't support falls back to the next best one.
+	enum Frustum_Batch
+	{
+		Frustum_Batch_Auto,
+		Frustum_Batch_Scalar,
+		Frustum_Batch_SSE,
+		Frustum_Batch_AVX
+	};
+
 	class Frustum
 	{
 	public:
@@ -36,8 +46,19 @@ namespace Directus::Math
 		~Frustum(){}
 
 		void Construct(const Matrix& mView, const Matrix&  mProjection, float screenDepth);
-		Intersection CheckCube(const Vector3& center, const Vector3& extent);
-		Intersection CheckSphere(const Vector3& center, float radius);
+		Intersection CheckCube(const Vector3& center, const Vector3& extent) const;
+		Intersection CheckSphere(const Vector3& center, float radius) const;
+
+		// Tests a batch of boxes, given as separate center and extent arrays (SoA). For every box that isn't 
+		// outside, the matching bit of visibility is set (box i is bit i % 32 of visibility[i / 32]).
+		// Uses AVX or SSE when the CPU supports them, 8 or 4 boxes at a time.
+		void CheckCubes(
+			const float* centerX, const float* centerY, const float* centerZ,
+			const float* extentX, const float* extentY, const float* extentZ,
+			unsigned int count,
+			unsigned int* visibility,
+			Frustum_Batch batch = Frustum_Batch_Auto
+		) const;
 
 	private:
 		Plane m_planes[6];
@@ -62,7 +62,7 @@ namespace Directus::Math
 		~Matrix() {}
 
 		//= TRANSLATION ===========================================
-		Vector3 GetTranslation() { return Vector3(m30, m31, m32); }
+		Vector3 GetTranslation() const { return Vector3(m30, m31, m32); }
 
 		static Matrix CreateTranslation(const Vector3& position)
 		{
@@ -108,7 +108,7 @@ namespace Directus::Math
 			);
 		}
 
-		Quaternion GetRotation()
+		Quaternion GetRotation() const
 		{
 			Vector3 scale = GetScale();
 
@@ -181,7 +181,7 @@ namespace Directus::Math
 		//================================================================================================
 
 		//= SCALE ========================================================================================
-		Vector3 GetScale()
+		Vector3 GetScale() const
 		{
 			int xs = (Sign(m00 * m01 * m02 * m03) < 0) ? -1 : 1;
             int ys = (Sign(m10 * m11 * m12 * m13) < 0) ? -1 : 1;
@@ -45,7 +45,7 @@ namespace Directus::Math
 
 	}
 
-	float Ray::HitDistance(const BoundingBox& box)
+	float Ray::HitDistance(const BoundingBox& box) const
 	{
 		// If undefined, no hit (infinite distance)
 		if (!box.Defined())
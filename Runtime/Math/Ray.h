@@ -42,7 +42,7 @@ namespace Directus::Math
 		~Ray();
 
 		// Returns hit distance to a bounding box, or infinity if there is no hit.
-		float HitDistance(const BoundingBox& box);
+		float HitDistance(const BoundingBox& box) const;
 
 		Vector3 GetOrigin() { return m_origin; }
 		Vector3 GetEnd() { return m_end; }
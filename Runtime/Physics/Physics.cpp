@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Physics.h"
 #include "../Core/Context.h"
 #include "../Core/Engine.h"
+#include "../Core/Timer.h"
 #include "../Core/EngineDefs.h"
 #include "../Logging/Log.h"
 #include "../Core/EventSystem.h"
@@ -47,7 +48,6 @@ using namespace Directus::Math;
 //=============================
 
 static const int MAX_SOLVER_ITERATIONS = 256;
-static const float INTERNAL_FPS = 60.0f;
 static const Vector3 GRAVITY = Vector3(0.0f, -9.81f, 0.0f);
 
 namespace Directus
@@ -58,7 +58,6 @@ namespace Directus
 		m_simulating = false;
 
 		// Subscribe to events
-		SUBSCRIBE_TO_EVENT(EVENT_UPDATE,			EVENT_HANDLER_VARIANT(Step));
 		SUBSCRIBE_TO_EVENT(EVENT_SCENE_CLEARED,		EVENT_HANDLER(Clear));
 	}
 
@@ -118,8 +117,9 @@ namespace Directus
 		float timeStep = VARIANT_GET_FROM(float, deltaTime);
 
 		// This equation must be met: timeStep < maxSubSteps * fixedTimeStep
-		float internalTimeStep = 1.0f / INTERNAL_FPS;
-		int maxSubsteps = (int)(timeStep * INTERNAL_FPS) + 1;
+		// The engine passes whole steps of the timer's fixed timestep, so they map to Bullet's sub-steps.
+		float internalTimeStep = m_context->GetSubsystem<Timer>()->GetFixedDeltaTimeSec();
+		int maxSubsteps = (int)(timeStep / internalTimeStep) + 1;
 		if (m_maxSubSteps < 0)
 		{
 			internalTimeStep = timeStep;
@@ -49,6 +49,8 @@ namespace Directus
 		m_timer						= nullptr;
 		m_resourceManager			= nullptr;
 		m_renderer					= nullptr;
+		m_renderTargets				= 0;
+		m_renderTargetMemory		= 0;
 	}
 
 	void Profiler::Initialize(Context* context)
@@ -58,18 +60,17 @@ namespace Directus
 		m_resourceManager	= context->GetSubsystem<ResourceManager>();
 		m_renderer			= context->GetSubsystem<Renderer>();
 		m_updateFrequencyMs = 200;
-
-		// Subscribe to update event
-		SUBSCRIBE_TO_EVENT(EVENT_UPDATE, EVENT_HANDLER(UpdateMetrics));
 	}
 
 	void Profiler::BeginBlock(const char* funcName)
 	{
+		lock_guard<mutex> lock(m_timeBlocksMutex);
 		m_timeBlocks[funcName].start = high_resolution_clock::now();
 	}
 
 	void Profiler::EndBlock(const char* funcName)
 	{
+		lock_guard<mutex> lock(m_timeBlocksMutex);
 		m_timeBlocks[funcName].end			= high_resolution_clock::now();
 		duration<double, milli> ms			= m_timeBlocks[funcName].end - m_timeBlocks[funcName].start;
 		m_timeBlocks[funcName].duration		= (float)ms.count();
@@ -97,11 +98,15 @@ namespace Directus
 			"Render:\t\t\t\t\t\t"				+ to_string_precision(GetBlockTimeMs("Directus::Renderer::Render"), 2) + " ms\n"
 			"Resolution:\t\t\t\t\t"				+ to_string(int(Settings::Get().GetResolutionWidth())) + "x" + to_string(int(Settings::Get().GetResolutionHeight())) + "\n"
 			"Meshes rendered:\t\t\t\t"			+ to_string(m_meshesRendered) + "\n"
+			"Meshes instanced:\t\t\t\t"			+ to_string(m_meshesInstanced) + "\n"
+			"Meshes not instanced:\t\t\t"		+ to_string(m_meshesRendered - m_meshesInstanced) + "\n"
 			"RHI Draw calls:\t\t\t\t\t"			+ to_string(m_drawCalls) + "\n"
+			"RHI Draw calls instanced:\t\t"		+ to_string(m_drawCallsInstanced) + "\n"
 			"RHI Index buffer bindings:\t\t"	+ to_string(m_bindBufferIndexCount) + "\n"
 			"RHI Vertex buffer bindings:\t"		+ to_string(m_bindBufferVertexCount) + "\n"
 			"RHI Uniform buffer bindings:\t"	+ to_string(m_bindUniformBufferCount) + "\n"
 			"RHI Shader bindings:\t\t\t"		+ to_string(m_bindShaderCount) + "\n"
+			"Render targets:\t\t\t\t\t"			+ to_string(m_renderTargets) + " (" + to_string_precision(m_renderTargetMemory / 1048576.0f, 2) + " MB)\n"
 			"Textures:\t\t\t\t\t\t"				+ to_string(textures) + "\n"
 			"Materials:\t\t\t\t\t\t"			+ to_string(materials) + "\n"
 			"Shaders:\t\t\t\t\t\t"				+ to_string(shaders);
@@ -25,6 +25,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/EngineDefs.h"
 #include <string>
 #include <map>
+#include <mutex>
 #include <chrono>
 //=============================
 
@@ -61,7 +62,7 @@ namespace Directus
 
 		void BeginBlock(const char* funcName);
 		void EndBlock(const char* funcName);
-		float GetBlockTimeMs(const char* funcName) { return m_timeBlocks[funcName].duration; }
+		float GetBlockTimeMs(const char* funcName) { std::lock_guard<std::mutex> lock(m_timeBlocksMutex); return m_timeBlocks[funcName].duration; }
 		const auto& GetAllBlocks() { return m_timeBlocks; }
 		void UpdateMetrics();
 		const std::string& GetMetrics() { return m_metrics; }
@@ -70,6 +71,8 @@ namespace Directus
 		{
 			m_drawCalls					= 0;
 			m_meshesRendered			= 0;
+			m_meshesInstanced			= 0;
+			m_drawCallsInstanced		= 0;
 			m_bindBufferIndexCount		= 0;
 			m_bindBufferVertexCount		= 0;
 			m_bindShaderCount			= 0;
@@ -78,17 +81,22 @@ namespace Directus
 
 		unsigned int m_drawCalls;
 		unsigned int m_meshesRendered;
+		unsigned int m_meshesInstanced;		// Of the meshes rendered, the ones drawn with instancing
+		unsigned int m_drawCallsInstanced;
 		unsigned int m_bindBufferIndexCount;
 		unsigned int m_bindBufferVertexCount;
 		unsigned int m_bindShaderCount;
 		unsigned int m_bindUniformBufferCount;
+		unsigned int m_renderTargets;				// Pooled by the render graph
+		unsigned long long m_renderTargetMemory;
 	
 	private:
 		// Converts float to string with specified precision
 		std::string to_string_precision(float value, int decimals);
 
-		// Timings
+		// Timings (blocks can begin and end from multiple threads)
 		std::map<const char*, Block> m_timeBlocks;
+		std::mutex m_timeBlocksMutex;
 
 		// Misc
 		float m_updateFrequencyMs;
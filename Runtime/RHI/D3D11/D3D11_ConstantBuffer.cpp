@@ -32,7 +32,7 @@ using namespace std;
 
 namespace Directus
 {
-	D3D11_ConstantBuffer::D3D11_ConstantBuffer(D3D11_Device* graphicsDevice) : m_graphics(graphicsDevice)
+	D3D11_ConstantBuffer::D3D11_ConstantBuffer(RHI* graphicsDevice) : m_graphics(graphicsDevice)
 	{
 		m_buffer = nullptr;
 	}
@@ -44,8 +44,12 @@ namespace Directus
 
 	bool D3D11_ConstantBuffer::Create(unsigned int size)
 	{
+		// Headless, system memory stands in for the buffer
 		if (!m_graphics->GetDevice())
-			return false;
+		{
+			m_headless.resize(size);
+			return true;
+		}
 
 		D3D11_BUFFER_DESC bufferDesc;
 		ZeroMemory(&bufferDesc, sizeof(bufferDesc));
@@ -68,8 +72,9 @@ namespace Directus
 
 	void* D3D11_ConstantBuffer::Map()
 	{
+		// Headless
 		if (!m_graphics->GetDeviceContext())
-			return nullptr;
+			return m_headless.empty() ? nullptr : m_headless.data();
 
 		if (!m_buffer)
 		{
@@ -91,7 +96,14 @@ namespace Directus
 
 	bool D3D11_ConstantBuffer::Unmap()
 	{
-		if (!m_buffer || !m_graphics->GetDeviceContext())
+		// Headless
+		if (!m_graphics->GetDeviceContext())
+		{
+			Profiler::Get().m_bindUniformBufferCount++;
+			return true;
+		}
+
+		if (!m_buffer)
 			return false;
 
 		// re-enable GPU access to the vertex buffer data.
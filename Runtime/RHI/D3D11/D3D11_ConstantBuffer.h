@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 //= INCLUDES ============
+#include <vector>
 #include "../RHI_Device.h"
 //=======================
 
@@ -30,7 +31,7 @@ namespace Directus
 	class D3D11_ConstantBuffer
 	{
 	public:
-		D3D11_ConstantBuffer(D3D11_Device* graphicsDevice);
+		D3D11_ConstantBuffer(RHI* graphicsDevice);
 		~D3D11_ConstantBuffer();
 
 		bool Create(unsigned int size);
@@ -42,7 +43,8 @@ namespace Directus
 		bool SetPS(unsigned int startSlot);
 
 	private:
-		D3D11_Device* m_graphics;
+		RHI* m_graphics;
 		ID3D11Buffer* m_buffer;
+		std::vector<unsigned char> m_headless; // Stands in for the buffer when there is no device
 	};
 }
\ No newline at end of file
@@ -32,6 +32,7 @@ using namespace std;
 using namespace Directus::Math;
 //=============================
 
+#ifdef API_D3D11
 namespace D3D11Settings
 {
 	const static D3D_DRIVER_TYPE driverType = D3D_DRIVER_TYPE_HARDWARE;
@@ -55,6 +56,9 @@ namespace Directus
 	{
 		m_device					= nullptr;
 		m_deviceContext				= nullptr;
+		m_deviceContext1			= nullptr;
+		m_mapNoOverwriteConstantBuffers	= false;
+		m_constantBufferOffsets		= false;
 		m_swapChain					= nullptr;
 		m_renderTargetView			= nullptr;
 		m_displayModeList			= nullptr;
@@ -94,6 +98,11 @@ namespace Directus
 		SafeRelease(m_depthStencilStateDisabled);
 		SafeRelease(m_depthStencilBuffer);
 		SafeRelease(m_renderTargetView);
+		for (auto& buffer : m_constantBuffersDiscard)
+		{
+			SafeRelease(buffer.second);
+		}
+		SafeRelease(m_deviceContext1);
 		SafeRelease(m_deviceContext);
 		SafeRelease(m_device);
 		SafeRelease(m_swapChain);
@@ -353,6 +362,25 @@ namespace Directus
 			return false;
 		}
 
+		// Constant buffer offsets and no-overwrite mapping (for the upload ring)
+		D3D11_FEATURE_DATA_D3D11_OPTIONS options = {};
+		if (SUCCEEDED(m_device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options))))
+		{
+			m_constantBufferOffsets			= options.ConstantBufferOffsetting != 0;
+			m_mapNoOverwriteConstantBuffers = options.MapNoOverwriteOnDynamicConstantBuffer != 0;
+		}
+		if (m_constantBufferOffsets && FAILED(m_deviceContext->QueryInterface(IID_PPV_ARGS(&m_deviceContext1))))
+		{
+			m_constantBufferOffsets = false;
+		}
+		if (!m_constantBufferOffsets || !m_mapNoOverwriteConstantBuffers)
+		{
+			// Without either, the offsets would be ignored (or the ring overwritten while in use), map per draw instead
+			LOG_WARNING("D3D11_Device::Initialize: Constant buffer offsets or no-overwrite mapping are not supported, constant buffers will be mapped per draw.");
+			m_constantBufferOffsets = false;
+			SafeRelease(m_deviceContext1);
+		}
+
 		// Log feature level and adapter info
 		D3D_FEATURE_LEVEL featureLevel = m_device->GetFeatureLevel();
 		string featureLevelStr;
@@ -410,6 +438,83 @@ namespace Directus
 		m_deviceContext->DrawIndexed(indexCount, indexOffset, vertexOffset);
 	}
 
+	void D3D11_Device::DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset)
+	{
+		if (!m_deviceContext)
+			return;
+
+		RHI_Device::DrawIndexedInstanced(indexCount, instanceCount, indexOffset, vertexOffset);
+		m_deviceContext->DrawIndexedInstanced(indexCount, instanceCount, indexOffset, vertexOffset, 0);
+	}
+
+	void* D3D11_Device::ConstantBuffer_Create(unsigned int size)
+	{
+		if (!m_device)
+			return nullptr;
+
+		if (!m_constantBufferOffsets)
+		{
+			auto buffer = new ConstantBuffer_Emulated();
+			buffer->memory.resize(size);
+			return buffer;
+		}
+
+		D3D11_BUFFER_DESC bufferDesc;
+		ZeroMemory(&bufferDesc, sizeof(bufferDesc));
+		bufferDesc.ByteWidth		= size;
+		bufferDesc.Usage			= D3D11_USAGE_DYNAMIC;
+		bufferDesc.BindFlags		= D3D11_BIND_CONSTANT_BUFFER;
+		bufferDesc.CPUAccessFlags	= D3D11_CPU_ACCESS_WRITE;
+
+		ID3D11Buffer* buffer = nullptr;
+		if (FAILED(m_device->CreateBuffer(&bufferDesc, nullptr, &buffer)))
+		{
+			LOG_ERROR("D3D11_Device::ConstantBuffer_Create: Failed to create constant buffer.");
+			return nullptr;
+		}
+
+		return buffer;
+	}
+
+	void D3D11_Device::ConstantBuffer_Release(void* buffer)
+	{
+		if (!m_constantBufferOffsets)
+		{
+			delete (ConstantBuffer_Emulated*)buffer;
+			return;
+		}
+
+		auto d3d11Buffer = (ID3D11Buffer*)buffer;
+		SafeRelease(d3d11Buffer);
+	}
+
+	void* D3D11_Device::ConstantBuffer_Map(void* buffer, bool discard)
+	{
+		if (!m_deviceContext || !buffer)
+			return nullptr;
+
+		if (!m_constantBufferOffsets)
+			return ((ConstantBuffer_Emulated*)buffer)->memory.data();
+
+		D3D11_MAPPED_SUBRESOURCE mappedResource;
+		if (FAILED(m_deviceContext->Map((ID3D11Buffer*)buffer, 0, discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedResource)))
+		{
+			LOG_ERROR("D3D11_Device::ConstantBuffer_Map: Failed to map constant buffer.");
+			return nullptr;
+		}
+
+		return mappedResource.pData;
+	}
+
+	void D3D11_Device::ConstantBuffer_Unmap(void* buffer)
+	{
+		if (!m_deviceContext || !buffer || !m_constantBufferOffsets)
+			return;
+
+		m_deviceContext->Unmap((ID3D11Buffer*)buffer, 0);
+		Profiler::Get().m_bindUniformBufferCount++;
+	}
+
 	void D3D11_Device::Clear(const Vector4& color)
 	{
 		if (!m_deviceContext)
@@ -463,6 +568,53 @@ namespace Directus
 		m_deviceContext->PSSetSamplers(startSlot, samplerCount, (ID3D11SamplerState**)&sampler[0]);
 	}
 
+	void D3D11_Device::Bind_ConstantBuffer(unsigned int slot, void* buffer, unsigned int offset, unsigned int size, bool vertexShader, bool pixelShader)
+	{
+		if (!m_deviceContext || !buffer)
+			return;
+
+		if (!m_constantBufferOffsets)
+		{
+			// Copy the range into a buffer of its size
+			ID3D11Buffer*& d3d11Buffer = m_constantBuffersDiscard[size];
+			if (!d3d11Buffer)
+			{
+				D3D11_BUFFER_DESC bufferDesc;
+				ZeroMemory(&bufferDesc, sizeof(bufferDesc));
+				bufferDesc.ByteWidth		= size;
+				bufferDesc.Usage			= D3D11_USAGE_DYNAMIC;
+				bufferDesc.BindFlags		= D3D11_BIND_CONSTANT_BUFFER;
+				bufferDesc.CPUAccessFlags	= D3D11_CPU_ACCESS_WRITE;
+				if (FAILED(m_device->CreateBuffer(&bufferDesc, nullptr, &d3d11Buffer)))
+				{
+					LOG_ERROR("D3D11_Device::Bind_ConstantBuffer: Failed to create constant buffer.");
+					return;
+				}
+			}
+
+			D3D11_MAPPED_SUBRESOURCE mappedResource;
+			if (FAILED(m_deviceContext->Map(d3d11Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource)))
+			{
+				LOG_ERROR("D3D11_Device::Bind_ConstantBuffer: Failed to map constant buffer.");
+				return;
+			}
+			memcpy(mappedResource.pData, ((ConstantBuffer_Emulated*)buffer)->memory.data() + offset, size);
+			m_deviceContext->Unmap(d3d11Buffer, 0);
+			Profiler::Get().m_bindUniformBufferCount++;
+
+			if (vertexShader)	m_deviceContext->VSSetConstantBuffers(slot, 1, &d3d11Buffer);
+			if (pixelShader)	m_deviceContext->PSSetConstantBuffers(slot, 1, &d3d11Buffer);
+			return;
+		}
+
+		// In constants (16 bytes each)
+		auto d3d11Buffer		= (ID3D11Buffer*)buffer;
+		UINT firstConstant		= offset / 16;
+		UINT constantCount		= size / 16;
+		if (vertexShader)	m_deviceContext1->VSSetConstantBuffers1(slot, 1, &d3d11Buffer, &firstConstant, &constantCount);
+		if (pixelShader)	m_deviceContext1->PSSetConstantBuffers1(slot, 1, &d3d11Buffer, &firstConstant, &constantCount);
+	}
+
 	bool D3D11_Device::SetResolution(int width, int height)
 	{
 		if (!RHI_Device::SetResolution(width, height))
@@ -846,3 +998,4 @@ namespace Directus
 		return string(adapterName) + " (" + to_string(adapterVRAM) + " MB)";
 	}
 }
+#endif
\ No newline at end of file
@@ -23,9 +23,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES ============
 #include <vector>
+#include <unordered_map>
 #include "../RHI_Device.h"
 //=======================
 
+#ifdef API_D3D11
 namespace Directus
 {
 	class D3D11_Device : public RHI_Device
@@ -41,6 +43,7 @@ namespace Directus
 		//= RI_DEVICE - RENDERING ==============================================================================
 		void Draw(unsigned int vertexCount) override;
 		void DrawIndexed(unsigned int indexCount, unsigned int indexOffset, unsigned int vertexOffset) override;
+		void DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset) override;
 		void Clear(const Math::Vector4& color) override;
 		void Present() override;
 		//======================================================================================================
@@ -50,8 +53,17 @@ namespace Directus
 		void Bind_RenderTargets(unsigned int renderTargetCount, void* const* renderTargets, void* depthStencil) override;
 		void Bind_Textures(unsigned int startSlot, unsigned int resourceCount, void* const* shaderResources) override;
 		void Bind_Samplers(unsigned int startSlot, unsigned int samplerCount, void* const* samplers) override;
+		void Bind_ConstantBuffer(unsigned int slot, void* buffer, unsigned int offset, unsigned int size, bool vertexShader, bool pixelShader) override;
 		//===============================================================================================================
 
+		//= RI_DEVICE - CONSTANT BUFFERS ==================================
+		void* ConstantBuffer_Create(unsigned int size) override;
+		void ConstantBuffer_Release(void* buffer) override;
+		void* ConstantBuffer_Map(void* buffer, bool discard) override;
+		void ConstantBuffer_Unmap(void* buffer) override;
+		bool ConstantBuffer_CanMapNoOverwrite() override { return !m_constantBufferOffsets || m_mapNoOverwriteConstantBuffers; }
+		//=================================================================
+
 		//= RI_DEVICE - VIEWPORT ==============================
 		const RHI_Viewport& GetViewport() override;
 		void SetViewport(const RHI_Viewport& viewport) override;
@@ -105,6 +117,17 @@ namespace Directus
 
 		ID3D11Device* m_device;
 		ID3D11DeviceContext* m_deviceContext;
+		ID3D11DeviceContext1* m_deviceContext1; // Binds constant buffers by offset
+		bool m_mapNoOverwriteConstantBuffers;
+		bool m_constantBufferOffsets;
+
+		// Without constant buffer offsets, the buffers handed out are system memory, and every bind
+		// copies the range into a (per size) dynamic buffer with Map(WRITE_DISCARD), then binds that.
+		struct ConstantBuffer_Emulated
+		{
+			std::vector<unsigned char> memory;
+		};
+		std::unordered_map<unsigned int, ID3D11Buffer*> m_constantBuffersDiscard;
 		IDXGISwapChain* m_swapChain;
 		ID3D11RenderTargetView* m_renderTargetView;	
 		unsigned int m_displayModeCount;
@@ -124,3 +147,4 @@ namespace Directus
 		ID3DUserDefinedAnnotation* m_eventReporter;
 	};
 }
+#endif
\ No newline at end of file
@@ -20,7 +20,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
 //= INCLUDES ========================
-#include "D3D11_Device.h"
 #include "D3D11_IndexBuffer.h"
 #include "../RHI_Implementation.h"
 #include "../../Logging/Log.h"
@@ -33,7 +32,7 @@ using namespace std;
 
 namespace Directus
 {
-	D3D11_IndexBuffer::D3D11_IndexBuffer(D3D11_Device* graphicsDevice) : m_graphics(graphicsDevice)
+	D3D11_IndexBuffer::D3D11_IndexBuffer(RHI* graphicsDevice) : m_graphics(graphicsDevice)
 	{
 		m_buffer = nullptr;
 		m_memoryUsage = 0;
@@ -46,7 +45,7 @@ namespace Directus
 
 	bool D3D11_IndexBuffer::Create(const vector<unsigned int>& indices)
 	{
-		if (!m_graphics->GetDevice() || indices.empty())
+		if (!m_graphics || indices.empty())
 			return false;
 
 		unsigned int stride = sizeof(unsigned int);
@@ -72,6 +71,10 @@ namespace Directus
 		// Compute memory usage
 		m_memoryUsage = (unsigned int)(sizeof(unsigned int) * indices.size());
 
+		// Headless, there is nothing to create
+		if (!m_graphics->GetDevice())
+			return true;
+
 		HRESULT result = m_graphics->GetDevice()->CreateBuffer(&bufferDesc, &initData, &m_buffer);
 		if FAILED(result)
 		{
@@ -84,7 +87,7 @@ namespace Directus
 
 	bool D3D11_IndexBuffer::CreateDynamic(unsigned int initialSize)
 	{
-		if (!m_graphics || !m_graphics->GetDevice())
+		if (!m_graphics)
 			return false;
 
 		unsigned int byteWidth = sizeof(unsigned int) * initialSize;
@@ -99,6 +102,13 @@ namespace Directus
 		bufferDesc.MiscFlags = 0;
 		bufferDesc.StructureByteStride = 0;
 
+		// Headless, system memory stands in for the buffer
+		if (!m_graphics->GetDevice())
+		{
+			m_headless.resize(byteWidth);
+			return true;
+		}
+
 		HRESULT result = m_graphics->GetDevice()->CreateBuffer(&bufferDesc, nullptr, &m_buffer);
 		if FAILED(result)
 		{
@@ -111,9 +121,13 @@ namespace Directus
 
 	void* D3D11_IndexBuffer::Map()
 	{
-		if (!m_graphics || !m_graphics->GetDeviceContext())
+		if (!m_graphics)
 			return nullptr;
 
+		// Headless
+		if (!m_graphics->GetDeviceContext())
+			return m_headless.empty() ? nullptr : m_headless.data();
+
 		if (!m_buffer)
 		{
 			LOG_ERROR("D3D11IndexBuffer: Can't map uninitialized index buffer.");
@@ -134,7 +148,14 @@ namespace Directus
 
 	bool D3D11_IndexBuffer::Unmap()
 	{
-		if (!m_graphics || !m_graphics->GetDeviceContext() || !m_buffer)
+		if (!m_graphics)
+			return false;
+
+		// Headless
+		if (!m_graphics->GetDeviceContext())
+			return true;
+
+		if (!m_buffer)
 			return false;
 
 		// re-enable GPU access to the index buffer data.
@@ -145,7 +166,14 @@ namespace Directus
 
 	bool D3D11_IndexBuffer::SetIA()
 	{
-		if (!m_graphics->GetDeviceContext() || !m_buffer)
+		// Headless
+		if (!m_graphics->GetDeviceContext())
+		{
+			Profiler::Get().m_bindBufferIndexCount++;
+			return true;
+		}
+
+		if (!m_buffer)
 			return false;
 
 		Profiler::Get().m_bindBufferIndexCount++;
@@ -31,7 +31,7 @@ namespace Directus
 	class D3D11_IndexBuffer
 	{
 	public:
-		D3D11_IndexBuffer(D3D11_Device* graphicsDevice);
+		D3D11_IndexBuffer(RHI* graphicsDevice);
 		~D3D11_IndexBuffer();
 
 		bool Create(const std::vector<unsigned int>& indices);
@@ -45,8 +45,9 @@ namespace Directus
 		unsigned int GetMemoryUsage() { return m_memoryUsage; }
 
 	private:
-		D3D11_Device* m_graphics;
+		RHI* m_graphics;
 		ID3D11Buffer* m_buffer;
+		std::vector<unsigned char> m_headless; // Stands in for a dynamic buffer when there is no device
 		unsigned int m_memoryUsage;
 	};
 }
@@ -28,7 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace Directus
 {
-	D3D11_InputLayout::D3D11_InputLayout(D3D11_Device* graphicsDevice) : m_graphics(graphicsDevice)
+	D3D11_InputLayout::D3D11_InputLayout(RHI* graphicsDevice) : m_graphics(graphicsDevice)
 	{
 		m_ID3D11InputLayout = nullptr;
 		m_inputLayout = Input_PositionTextureTBN;
@@ -42,8 +42,9 @@ namespace Directus
 	//= MISC ==================================================
 	bool D3D11_InputLayout::Set()
 	{
+		// Headless
 		if (!m_graphics->GetDeviceContext())
-			return false;
+			return true;
 
 		m_graphics->GetDeviceContext()->IASetInputLayout(m_ID3D11InputLayout);
 		return true;
@@ -31,7 +31,7 @@ namespace Directus
 	class D3D11_InputLayout
 	{
 	public:
-		D3D11_InputLayout(D3D11_Device* d3d11Device);
+		D3D11_InputLayout(RHI* d3d11Device);
 		~D3D11_InputLayout();
 
 		//= MISC ====================================
@@ -51,7 +51,7 @@ namespace Directus
 		bool CreatePosTBNDesc(ID3D10Blob* VSBlob);
 		//========================================
 
-		D3D11_Device* m_graphics;
+		RHI* m_graphics;
 		ID3D11InputLayout* m_ID3D11InputLayout;
 		Input_Layout m_inputLayout;
 		std::vector<D3D11_INPUT_ELEMENT_DESC> m_layoutDesc;
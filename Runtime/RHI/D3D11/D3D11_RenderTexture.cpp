@@ -32,7 +32,7 @@ using namespace Directus::Math;
 
 namespace Directus
 {
-	D3D11_RenderTexture::D3D11_RenderTexture(D3D11_Device* graphics, int width, int height, bool depth, Texture_Format format)
+	D3D11_RenderTexture::D3D11_RenderTexture(RHI* graphics, int width, int height, bool depth, Texture_Format format)
 	{
 		m_renderTargetTexture	= nullptr;
 		m_renderTargetView		= nullptr;
@@ -60,11 +60,9 @@ namespace Directus
 
 	bool D3D11_RenderTexture::SetAsRenderTarget()
 	{
+		// Headless
 		if (!m_graphics->GetDeviceContext())
-		{
-			LOG_INFO("Uninitialized device context. Can't set render texture as rander target");
-			return false;
-		}
+			return true;
 
 		// Bind the render target view and depth stencil buffer to the output render pipeline.
 		m_graphics->GetDeviceContext()->OMSetRenderTargets(1, &m_renderTargetView, m_depthStencilView);
@@ -77,8 +75,9 @@ namespace Directus
 
 	bool D3D11_RenderTexture::Clear(const Vector4& clearColor)
 	{
+		// Headless
 		if (!m_graphics->GetDeviceContext())
-			return false;
+			return true;
 
 		// Clear back buffer
 		m_graphics->GetDeviceContext()->ClearRenderTargetView(m_renderTargetView, clearColor.Data()); 
@@ -109,11 +108,9 @@ namespace Directus
 
 	bool D3D11_RenderTexture::Construct()
 	{
+		// Headless, nothing to create
 		if (!m_graphics->GetDevice())
-		{
-			LOG_INFO("D3D11RenderTexture::Construct: Uninitialized device. Can't create render texture");
-			return false;
-		}
+			return true;
 
 		// RENDER TARGET TEXTURE
 		{
@@ -33,7 +33,7 @@ namespace Directus
 	{
 	public:
 		D3D11_RenderTexture(
-			D3D11_Device* graphics, 
+			RHI* graphics, 
 			int width				= Settings::Get().GetResolutionWidth(), 
 			int height				= Settings::Get().GetResolutionHeight(), 
 			bool depth				= false,
@@ -72,6 +72,6 @@ namespace Directus
 		Math::Matrix m_orthographicProjectionMatrix;
 
 		RHI_Viewport m_viewport;
-		D3D11_Device* m_graphics;
+		RHI* m_graphics;
 	};
 }
\ No newline at end of file
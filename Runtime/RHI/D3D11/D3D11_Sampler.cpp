@@ -20,7 +20,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
 //= INCLUDES =====================
-#include "D3D11_Device.h"
 #include "D3D11_Sampler.h"
 #include "../RHI_Implementation.h"
 #include "../../Core/EngineDefs.h"
@@ -30,7 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace Directus
 {
-	D3D11_Sampler::D3D11_Sampler(D3D11_Device* device,
+	D3D11_Sampler::D3D11_Sampler(RHI* device,
 		Texture_Sampler_Filter filter					/*= Texture_Sampler_Anisotropic*/,
 		Texture_Address_Mode textureAddressMode			/*= Texture_Address_Wrap*/, 
 		Texture_Comparison_Function comparisonFunction	/*= Texture_Comparison_Always*/)
@@ -41,6 +40,10 @@ namespace Directus
 			return;
 		}
 
+		// Headless, nothing to create
+		if (!device->GetDevice())
+			return;
+
 		D3D11_SAMPLER_DESC samplerDesc;
 		samplerDesc.Filter			= d3d11_filter[filter];
 		samplerDesc.AddressU		= d3d11_texture_address_mode[textureAddressMode];
@@ -30,7 +30,7 @@ namespace Directus
 	class D3D11_Sampler
 	{
 	public:
-		D3D11_Sampler(D3D11_Device* graphics, 
+		D3D11_Sampler(RHI* graphics, 
 			Texture_Sampler_Filter filter					= Texture_Sampler_Anisotropic,
 			Texture_Address_Mode textureAddressMode			= Texture_Address_Wrap,
 			Texture_Comparison_Function comparisonFunction	= Texture_Comparison_Always);
@@ -36,7 +36,7 @@ using namespace std;
 
 namespace Directus
 {
-	D3D11_Shader::D3D11_Shader(D3D11_Device* graphicsDevice) : m_graphics(graphicsDevice)
+	D3D11_Shader::D3D11_Shader(RHI* graphicsDevice) : m_graphics(graphicsDevice)
 	{
 		m_vertexShader		= nullptr;
 		m_pixelShader		= nullptr;
@@ -60,6 +60,13 @@ namespace Directus
 	{
 		m_filePath = filePath;
 
+		// Headless, there is nothing to compile the shader for
+		if (!m_graphics->GetDevice())
+		{
+			m_compiled = true;
+			return m_compiled;
+		}
+
 		//= Vertex shader =================================================
 		vector<D3D_SHADER_MACRO> vsMacros = m_macros;
 		vsMacros.push_back(D3D_SHADER_MACRO{ "COMPILE_VS", "1" });
@@ -103,8 +110,12 @@ namespace Directus
 
 	bool D3D11_Shader::SetInputLayout(Input_Layout inputLayout)
 	{
+		// Headless
 		if (!m_graphics->GetDevice())
-			return false;
+		{
+			m_layoutHasBeenSet = true;
+			return m_layoutHasBeenSet;
+		}
 
 		if (!m_compiled)
 		{
@@ -147,6 +158,13 @@ namespace Directus
 		if (!m_compiled)
 			return false;
 
+		// Headless
+		if (!m_graphics->GetDeviceContext())
+		{
+			Profiler::Get().m_bindShaderCount++;
+			return true;
+		}
+
 		bool success = true;
 
 		// Set the vertex input layout.
@@ -35,7 +35,7 @@ namespace Directus
 	class D3D11_Shader
 	{
 	public:
-		D3D11_Shader(D3D11_Device* graphicsDevice);
+		D3D11_Shader(RHI* graphicsDevice);
 		~D3D11_Shader();
 
 		bool Compile(const std::string& filePath);
@@ -78,6 +78,6 @@ namespace Directus
 		bool m_layoutHasBeenSet;
 
 		//= DEPENDENCIES============
-		D3D11_Device* m_graphics;
+		RHI* m_graphics;
 	};
 }
@@ -31,7 +31,7 @@ using namespace std;
 
 namespace Directus
 {
-	D3D11_Texture::D3D11_Texture(D3D11_Device* graphics)
+	D3D11_Texture::D3D11_Texture(RHI* graphics)
 	{
 		m_shaderResourceView = nullptr;
 		m_graphics = graphics;
@@ -49,11 +49,9 @@ namespace Directus
 
 	bool D3D11_Texture::Create(unsigned int width, unsigned int height, unsigned int channels, const vector<std::byte>& data, Texture_Format format)
 	{
+		// Headless, the texture keeps its CPU data only
 		if (!m_graphics->GetDevice())
-		{
-			LOG_ERROR("D3D11_Texture::Create: Invalid device.");
-			return false;
-		}
+			return true;
 
 		if (data.empty())
 		{
@@ -115,13 +113,12 @@ namespace Directus
 
 	bool D3D11_Texture::CreateFromMipmaps(unsigned int width, unsigned int height, unsigned int channels, const vector<vector<std::byte>>& mipmaps, Texture_Format format)
 	{
+		// Headless, the texture keeps its CPU data only
 		if (!m_graphics->GetDevice())
-		{
-			LOG_ERROR("D3D11_Texture::CreateFromMipmaps: Invalid device.");
-			return false;
-		}
+			return true;
 
 		unsigned int mipLevels = (unsigned int)mipmaps.size();
+		m_memoryUsage = 0;
 
 		vector<D3D11_SUBRESOURCE_DATA> subresourceData;
 		vector<D3D11_TEXTURE2D_DESC> textureDescs;
@@ -174,7 +171,15 @@ namespace Directus
 		srvDesc.Texture2D.MostDetailedMip	= 0;
 		srvDesc.Texture2D.MipLevels			= mipLevels;
 
+		if (m_shaderResourceView)
+		{
+			m_shaderResourceView->Release();
+			m_shaderResourceView = nullptr;
+		}
+
+		// The view keeps the texture alive, release it along with the view (textures are re-created as mips stream in and out)
 		result = m_graphics->GetDevice()->CreateShaderResourceView(texture, &srvDesc, &m_shaderResourceView);
+		texture->Release();
 		if (FAILED(result))
 		{
 			LOG_ERROR("D3D11_Texture::CreateFromMipmaps: Failed to create the ID3D11ShaderResourceView.");
@@ -186,11 +191,9 @@ namespace Directus
 
 	bool D3D11_Texture::CreateAndGenerateMipmaps(unsigned int width, int height, unsigned int channels, const std::vector<std::byte>& data, Texture_Format format)
 	{
+		// Headless, the texture keeps its CPU data only
 		if (!m_graphics->GetDevice())
-		{
-			LOG_ERROR("D3D11_Texture::CreateAndGenerateMipmaps: Invalid device.");
-			return false;
-		}
+			return true;
 
 		unsigned int mipLevels = 7;
 
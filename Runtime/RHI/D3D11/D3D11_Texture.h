@@ -31,7 +31,7 @@ namespace Directus
 	class D3D11_Texture
 	{
 	public:
-		D3D11_Texture(D3D11_Device* context);
+		D3D11_Texture(RHI* context);
 		~D3D11_Texture();
 
 		// Create from data
@@ -51,7 +51,7 @@ namespace Directus
 
 	private:
 		ID3D11ShaderResourceView* m_shaderResourceView;
-		D3D11_Device* m_graphics;
+		RHI* m_graphics;
 		unsigned int m_memoryUsage;
 	};
 }
@@ -32,7 +32,7 @@ using namespace std;
 
 namespace Directus
 {
-	D3D11_VertexBuffer::D3D11_VertexBuffer(D3D11_Device* graphicsDevice)
+	D3D11_VertexBuffer::D3D11_VertexBuffer(RHI* graphicsDevice)
 	{
 		m_graphics = graphicsDevice;
 		m_buffer = nullptr;
@@ -47,7 +47,7 @@ namespace Directus
 
 	bool D3D11_VertexBuffer::Create(const vector<RHI_Vertex_PosCol>& vertices)
 	{
-		if (!m_graphics->GetDevice() || vertices.empty())
+		if (!m_graphics || vertices.empty())
 			return false;
 
 		m_stride = sizeof(RHI_Vertex_PosCol);
@@ -73,6 +73,10 @@ namespace Directus
 		// Compute memory usage
 		m_memoryUsage = (unsigned int)(sizeof(RHI_Vertex_PosCol) * vertices.size());
 
+		// Headless, there is nothing to create
+		if (!m_graphics->GetDevice())
+			return true;
+
 		HRESULT result = m_graphics->GetDevice()->CreateBuffer(&bufferDesc, &initData, &m_buffer);
 		if (FAILED(result))
 		{
@@ -85,7 +89,7 @@ namespace Directus
 
 	bool D3D11_VertexBuffer::Create(const vector<RHI_Vertex_PosUV>& vertices)
 	{
-		if (!m_graphics || !m_graphics->GetDevice() || vertices.empty())
+		if (!m_graphics || vertices.empty())
 			return false;
 
 		m_stride = sizeof(RHI_Vertex_PosUV);
@@ -111,6 +115,10 @@ namespace Directus
 		// Compute memory usage
 		m_memoryUsage = (unsigned int)(sizeof(RHI_Vertex_PosUV) * vertices.size());
 
+		// Headless, there is nothing to create
+		if (!m_graphics->GetDevice())
+			return true;
+
 		HRESULT result = m_graphics->GetDevice()->CreateBuffer(&bufferDesc, &initData, &m_buffer);
 		if (FAILED(result))
 		{
@@ -123,7 +131,7 @@ namespace Directus
 
 	bool D3D11_VertexBuffer::Create(const vector<RHI_Vertex_PosUVTBN>& vertices)
 	{
-		if (!m_graphics || !m_graphics->GetDevice() || vertices.empty())
+		if (!m_graphics || vertices.empty())
 			return false;
 
 		m_stride = sizeof(RHI_Vertex_PosUVTBN);
@@ -149,6 +157,10 @@ namespace Directus
 		// Compute memory usage
 		m_memoryUsage = (unsigned int)(sizeof(RHI_Vertex_PosUVTBN) * vertices.size());
 
+		// Headless, there is nothing to create
+		if (!m_graphics->GetDevice())
+			return true;
+
 		HRESULT result = m_graphics->GetDevice()->CreateBuffer(&bufferDesc, &initData, &m_buffer);
 		if (FAILED(result))
 		{
@@ -161,7 +173,7 @@ namespace Directus
 
 	bool D3D11_VertexBuffer::CreateDynamic(unsigned int stride, unsigned int initialSize)
 	{
-		if (!m_graphics || !m_graphics->GetDevice())
+		if (!m_graphics)
 			return false;
 
 		m_stride = stride;
@@ -177,6 +189,13 @@ namespace Directus
 		bufferDesc.MiscFlags = 0;
 		bufferDesc.StructureByteStride = 0;
 
+		// Headless, system memory stands in for the buffer
+		if (!m_graphics->GetDevice())
+		{
+			m_headless.resize(byteWidth);
+			return true;
+		}
+
 		HRESULT result = m_graphics->GetDevice()->CreateBuffer(&bufferDesc, nullptr, &m_buffer);
 		if FAILED(result)
 		{
@@ -195,11 +214,9 @@ namespace Directus
 			return nullptr;
 		}
 
+		// Headless
 		if (!m_graphics->GetDeviceContext())
-		{
-			LOG_ERROR("D3D11VertexBuffer: Can't map. Graphics adapter context is uninitialized.");
-			return nullptr;
-		}
+			return m_headless.empty() ? nullptr : m_headless.data();
 
 		if (!m_buffer)
 		{
@@ -227,11 +244,9 @@ namespace Directus
 			return false;
 		}
 
+		// Headless
 		if (!m_graphics->GetDeviceContext())
-		{
-			LOG_ERROR("D3D11VertexBuffer: Can't unmap. Graphics adapter context is uninitialized.");
-			return false;
-		}
+			return true;
 
 		if (!m_buffer)
 		{
@@ -253,10 +268,11 @@ namespace Directus
 			return false;
 		}
 
+		// Headless
 		if (!m_graphics->GetDeviceContext())
 		{
-			LOG_ERROR("D3D11VertexBuffer: Can't set input assembly. Graphics adapter context is uninitialized.");
-			return false;
+			Profiler::Get().m_bindBufferVertexCount++;
+			return true;
 		}
 
 		if (!m_buffer)
@@ -32,7 +32,7 @@ namespace Directus
 	class D3D11_VertexBuffer
 	{
 	public:
-		D3D11_VertexBuffer(D3D11_Device* graphicsDevice);
+		D3D11_VertexBuffer(RHI* graphicsDevice);
 		~D3D11_VertexBuffer();
 
 		bool Create(const std::vector<RHI_Vertex_PosCol>& vertices);
@@ -48,8 +48,9 @@ namespace Directus
 		unsigned int GetMemoryUsage() { return m_memoryUsage; }
 
 	private:
-		D3D11_Device* m_graphics;
+		RHI* m_graphics;
 		ID3D11Buffer* m_buffer;
+		std::vector<unsigned char> m_headless; // Stands in for a dynamic buffer when there is no device
 		unsigned int m_stride;
 		unsigned int m_memoryUsage;
 	};
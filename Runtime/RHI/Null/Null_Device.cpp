@@ -0,0 +1,151 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ====================
+#include <vector>
+#include "Null_Device.h"
+#include "../../Logging/Log.h"
+#include "../../Core/Settings.h"
+//===============================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+namespace Directus
+{
+	Null_Device::Null_Device(Context* context) : RHI_Device(context)
+	{
+		m_initialized = false;
+	}
+
+	Null_Device::~Null_Device()
+	{
+
+	}
+
+	bool Null_Device::Initialize()
+	{
+		m_backBufferViewport	= RHI_Viewport((float)Settings::Get().GetResolutionWidth(), (float)Settings::Get().GetResolutionHeight());
+		m_viewport				= m_backBufferViewport;
+		m_initialized			= true;
+
+		LOG_INFO("Null_Device::Initialize: Headless, no GPU objects will be created.");
+		return true;
+	}
+
+	void Null_Device::Draw(unsigned int vertexCount)
+	{
+		RHI_Device::Draw(vertexCount);
+		m_stats.draws++;
+	}
+
+	void Null_Device::DrawIndexed(unsigned int indexCount, unsigned int indexOffset, unsigned int vertexOffset)
+	{
+		RHI_Device::DrawIndexed(indexCount, indexOffset, vertexOffset);
+		m_stats.draws++;
+		HashDraw(indexCount, 1, indexOffset, vertexOffset);
+	}
+
+	void Null_Device::DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset)
+	{
+		RHI_Device::DrawIndexedInstanced(indexCount, instanceCount, indexOffset, vertexOffset);
+		m_stats.draws++;
+		m_stats.drawsInstanced++;
+		m_stats.instances += instanceCount;
+		HashDraw(indexCount, instanceCount, indexOffset, vertexOffset);
+	}
+
+	void Null_Device::HashDraw(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset)
+	{
+		// FNV-1a, so that recordings which issue the same draws in a different order (or miss some) can be told apart
+		for (unsigned int value : { indexCount, instanceCount, indexOffset, vertexOffset })
+		{
+			m_stats.drawHash = (m_stats.drawHash ^ value) * 1099511628211ULL;
+		}
+	}
+
+	void* Null_Device::ConstantBuffer_Create(unsigned int size)
+	{
+		return new vector<unsigned char>(size);
+	}
+
+	void Null_Device::ConstantBuffer_Release(void* buffer)
+	{
+		delete (vector<unsigned char>*)buffer;
+	}
+
+	void* Null_Device::ConstantBuffer_Map(void* buffer, bool discard)
+	{
+		if (!buffer)
+			return nullptr;
+
+		m_stats.constantBufferMaps++;
+		return ((vector<unsigned char>*)buffer)->data();
+	}
+
+	bool Null_Device::SetResolution(int width, int height)
+	{
+		if (!RHI_Device::SetResolution(width, height))
+			return false;
+
+		m_backBufferViewport.SetWidth((float)width);
+		m_backBufferViewport.SetHeight((float)height);
+		m_stats.stateChanges++;
+		return true;
+	}
+
+	bool Null_Device::EnableDepth(bool enable)
+	{
+		if (!RHI_Device::EnableDepth(enable))
+			return false;
+
+		m_stats.stateChanges++;
+		return true;
+	}
+
+	bool Null_Device::EnableAlphaBlending(bool enable)
+	{
+		if (!RHI_Device::EnableAlphaBlending(enable))
+			return false;
+
+		m_stats.stateChanges++;
+		return true;
+	}
+
+	bool Null_Device::SetCullMode(Cull_Mode cullMode)
+	{
+		if (!RHI_Device::SetCullMode(cullMode))
+			return false;
+
+		m_stats.stateChanges++;
+		return true;
+	}
+
+	bool Null_Device::Set_PrimitiveTopology(PrimitiveTopology_Mode primitiveTopology)
+	{
+		if (!RHI_Device::Set_PrimitiveTopology(primitiveTopology))
+			return false;
+
+		m_stats.stateChanges++;
+		return true;
+	}
+}
@@ -0,0 +1,113 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ============
+#include "../RHI_Device.h"
+//=======================
+
+namespace Directus
+{
+	// A device which creates no GPU objects, so that the engine can run headless (e.g. for CPU performance runs).
+	// It accepts every bind and draw and records what it was asked to do.
+	class Null_Device : public RHI_Device
+	{
+	public:
+		Null_Device(Context* context);
+		~Null_Device();
+
+		//= Sybsystem =============
+		bool Initialize() override;
+		//=========================
+
+		//= RI_DEVICE - RENDERING ==============================================================================
+		void Draw(unsigned int vertexCount) override;
+		void DrawIndexed(unsigned int indexCount, unsigned int indexOffset, unsigned int vertexOffset) override;
+		void DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset) override;
+		void Clear(const Math::Vector4& color) override {}
+		void Present() override { m_stats.presents++; }
+		//======================================================================================================
+
+		//= RI_DEVICE - BINDING =========================================================================================
+		void Bind_BackBufferAsRenderTarget() override																{ m_stats.renderTargetBinds++; }
+		void Bind_RenderTargets(unsigned int renderTargetCount, void* const* renderTargets, void* depthStencil) override	{ m_stats.renderTargetBinds++; }
+		void Bind_Textures(unsigned int startSlot, unsigned int resourceCount, void* const* shaderResources) override	{ m_stats.textureBinds += resourceCount; }
+		void Bind_Samplers(unsigned int startSlot, unsigned int samplerCount, void* const* samplers) override			{ m_stats.samplerBinds += samplerCount; }
+		void Bind_ConstantBuffer(unsigned int slot, void* buffer, unsigned int offset, unsigned int size, bool vertexShader, bool pixelShader) override { m_stats.constantBufferBinds++; }
+		//===============================================================================================================
+
+		//= RI_DEVICE - CONSTANT BUFFERS ======================================================
+		// Backed by system memory, so that whatever is packed into them is actually written
+		void* ConstantBuffer_Create(unsigned int size) override;
+		void ConstantBuffer_Release(void* buffer) override;
+		void* ConstantBuffer_Map(void* buffer, bool discard) override;
+		void ConstantBuffer_Unmap(void* buffer) override	{ m_stats.constantBufferUnmaps++; }
+		bool ConstantBuffer_CanMapNoOverwrite() override	{ return true; }
+		//=====================================================================================
+
+		//= RI_DEVICE - VIEWPORT ========================================================
+		const RHI_Viewport& GetViewport() override				{ return m_viewport; }
+		void SetViewport(const RHI_Viewport& viewport) override	{ m_viewport = viewport; }
+		//===============================================================================
+
+		//= RI_DEVICE - STATE =====================================================
+		bool SetResolution(int width, int height) override;
+		bool EnableDepth(bool enable) override;
+		bool EnableAlphaBlending(bool enable) override;
+		Cull_Mode GetCullMode() override { return m_cullMode; }
+		bool SetCullMode(Cull_Mode cullMode) override;
+		bool Set_PrimitiveTopology(PrimitiveTopology_Mode primitiveTopology) override;
+		//=========================================================================
+
+		bool IsInitialized() override { return m_initialized; }
+
+		// The D3D11 resources are created against this device, without a device they create nothing
+		ID3D11Device* GetDevice()						{ return nullptr; }
+		ID3D11DeviceContext* GetDeviceContext()			{ return nullptr; }
+		ID3D11DepthStencilView* GetDepthStencilView()	{ return nullptr; }
+
+		// Everything the device was asked to do, since it was created
+		struct Stats
+		{
+			unsigned long long draws				= 0;
+			unsigned long long drawsInstanced		= 0;
+			unsigned long long instances			= 0;
+			unsigned long long presents				= 0;
+			unsigned long long renderTargetBinds	= 0;
+			unsigned long long textureBinds			= 0;
+			unsigned long long samplerBinds			= 0;
+			unsigned long long constantBufferBinds	= 0;
+			unsigned long long constantBufferMaps	= 0;
+			unsigned long long constantBufferUnmaps	= 0;
+			unsigned long long stateChanges			= 0; // Depth, blending, culling, topology and resolution
+			unsigned long long drawHash				= 14695981039346656037ULL; // Of every draw's arguments, in order
+		};
+		const Stats& GetStats() { return m_stats; }
+
+	private:
+		void HashDraw(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset);
+
+		RHI_Viewport m_viewport;
+		Stats m_stats;
+		bool m_initialized;
+	};
+}
@@ -0,0 +1,165 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ===========================
+#include "RHI_CommandList.h"
+#include "RHI_Device.h"
+#include "D3D11/D3D11_VertexBuffer.h"
+#include "D3D11/D3D11_IndexBuffer.h"
+#include "D3D11/D3D11_Shader.h"
+//======================================
+
+namespace Directus
+{
+	void RHI_CommandList::Clear()
+	{
+		m_commands.clear();
+		m_textures.clear();
+	}
+
+	void RHI_CommandList::SetCullMode(Cull_Mode cullMode)
+	{
+		Add(RHI_Cmd_SetCullMode).cullMode = cullMode;
+	}
+
+	void RHI_CommandList::Set_PrimitiveTopology(PrimitiveTopology_Mode primitiveTopology)
+	{
+		Add(RHI_Cmd_SetPrimitiveTopology).primitiveTopology = primitiveTopology;
+	}
+
+	void RHI_CommandList::Bind_VertexBuffer(D3D11_VertexBuffer* buffer)
+	{
+		Add(RHI_Cmd_BindVertexBuffer).vertexBuffer = buffer;
+	}
+
+	void RHI_CommandList::Bind_IndexBuffer(D3D11_IndexBuffer* buffer)
+	{
+		Add(RHI_Cmd_BindIndexBuffer).indexBuffer = buffer;
+	}
+
+	void RHI_CommandList::Bind_Shader(D3D11_Shader* shader)
+	{
+		Add(RHI_Cmd_BindShader).shader = shader;
+	}
+
+	void RHI_CommandList::Bind_ConstantBuffer(unsigned int slot, void* buffer, unsigned int offset, unsigned int size, bool vertexShader, bool pixelShader)
+	{
+		RHI_Command& command				= Add(RHI_Cmd_BindConstantBuffer);
+		command.constantBuffer.buffer		= buffer;
+		command.constantBuffer.slot			= slot;
+		command.constantBuffer.offset		= offset;
+		command.constantBuffer.size			= size;
+		command.constantBuffer.vertexShader	= vertexShader;
+		command.constantBuffer.pixelShader	= pixelShader;
+	}
+
+	void RHI_CommandList::Bind_Textures(unsigned int startSlot, unsigned int textureCount, void* const* textures)
+	{
+		if (textureCount == 0)
+			return;
+
+		RHI_Command& command		= Add(RHI_Cmd_BindTextures);
+		command.textures.startSlot	= startSlot;
+		command.textures.count		= textureCount;
+		command.textures.first		= (unsigned int)m_textures.size();
+		m_textures.insert(m_textures.end(), textures, textures + textureCount);
+	}
+
+	void RHI_CommandList::DrawIndexed(unsigned int indexCount, unsigned int indexOffset, unsigned int vertexOffset)
+	{
+		RHI_Command& command		= Add(RHI_Cmd_DrawIndexed);
+		command.draw.indexCount		= indexCount;
+		command.draw.instanceCount	= 1;
+		command.draw.indexOffset	= indexOffset;
+		command.draw.vertexOffset	= vertexOffset;
+	}
+
+	void RHI_CommandList::DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset)
+	{
+		RHI_Command& command		= Add(RHI_Cmd_DrawIndexedInstanced);
+		command.draw.indexCount		= indexCount;
+		command.draw.instanceCount	= instanceCount;
+		command.draw.indexOffset	= indexOffset;
+		command.draw.vertexOffset	= vertexOffset;
+	}
+
+	void RHI_CommandList::Submit(RHI_Device* rhiDevice)
+	{
+		if (!rhiDevice)
+			return;
+
+		for (const auto& command : m_commands)
+		{
+			switch (command.type)
+			{
+			case RHI_Cmd_SetCullMode:
+				rhiDevice->SetCullMode(command.cullMode);
+				break;
+
+			case RHI_Cmd_SetPrimitiveTopology:
+				rhiDevice->Set_PrimitiveTopology(command.primitiveTopology);
+				break;
+
+			case RHI_Cmd_BindVertexBuffer:
+				command.vertexBuffer->SetIA();
+				break;
+
+			case RHI_Cmd_BindIndexBuffer:
+				command.indexBuffer->SetIA();
+				break;
+
+			case RHI_Cmd_BindShader:
+				command.shader->Bind();
+				break;
+
+			case RHI_Cmd_BindConstantBuffer:
+				rhiDevice->Bind_ConstantBuffer(
+					command.constantBuffer.slot,
+					command.constantBuffer.buffer,
+					command.constantBuffer.offset,
+					command.constantBuffer.size,
+					command.constantBuffer.vertexShader,
+					command.constantBuffer.pixelShader
+				);
+				break;
+
+			case RHI_Cmd_BindTextures:
+				rhiDevice->Bind_Textures(command.textures.startSlot, command.textures.count, &m_textures[command.textures.first]);
+				break;
+
+			case RHI_Cmd_DrawIndexed:
+				rhiDevice->DrawIndexed(command.draw.indexCount, command.draw.indexOffset, command.draw.vertexOffset);
+				break;
+
+			case RHI_Cmd_DrawIndexedInstanced:
+				rhiDevice->DrawIndexedInstanced(command.draw.indexCount, command.draw.instanceCount, command.draw.indexOffset, command.draw.vertexOffset);
+				break;
+			}
+		}
+	}
+
+	RHI_Command& RHI_CommandList::Add(RHI_Command_Type type)
+	{
+		m_commands.emplace_back();
+		m_commands.back().type = type;
+		return m_commands.back();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==================
+#include <vector>
+#include "../Core/EngineDefs.h"
+#include "RHI_Definition.h"
+//=============================
+
+namespace Directus
+{
+	class RHI_Device;
+
+	enum RHI_Command_Type
+	{
+		RHI_Cmd_SetCullMode,
+		RHI_Cmd_SetPrimitiveTopology,
+		RHI_Cmd_BindVertexBuffer,
+		RHI_Cmd_BindIndexBuffer,
+		RHI_Cmd_BindShader,
+		RHI_Cmd_BindConstantBuffer,
+		RHI_Cmd_BindTextures,
+		RHI_Cmd_DrawIndexed,
+		RHI_Cmd_DrawIndexedInstanced
+	};
+
+	struct RHI_Command
+	{
+		RHI_Command_Type type;
+		union
+		{
+			Cull_Mode cullMode;
+			PrimitiveTopology_Mode primitiveTopology;
+			D3D11_VertexBuffer* vertexBuffer;
+			D3D11_IndexBuffer* indexBuffer;
+			D3D11_Shader* shader;
+			struct { void* buffer; unsigned int slot, offset, size; bool vertexShader, pixelShader; } constantBuffer;
+			struct { unsigned int startSlot, count, first; } textures; // first indexes the list's texture storage
+			struct { unsigned int indexCount, instanceCount, indexOffset, vertexOffset; } draw;
+		};
+	};
+
+	// Records RHI commands so that they can be issued later. Recording is possible on any thread (one thread per
+	// list), submitting has to happen on the thread that owns the device. Lists are submitted in the order required.
+	// Whatever a command points to (buffers, shaders, textures) has to stay alive until the list is submitted.
+	class ENGINE_CLASS RHI_CommandList
+	{
+	public:
+		RHI_CommandList() {}
+		~RHI_CommandList() {}
+
+		// Forgets the recorded commands, the memory is kept for the next recording
+		void Clear();
+
+		//= RECORDING ===================================================================================================================
+		void SetCullMode(Cull_Mode cullMode);
+		void Set_PrimitiveTopology(PrimitiveTopology_Mode primitiveTopology);
+		void Bind_VertexBuffer(D3D11_VertexBuffer* buffer);
+		void Bind_IndexBuffer(D3D11_IndexBuffer* buffer);
+		void Bind_Shader(D3D11_Shader* shader);
+		void Bind_ConstantBuffer(unsigned int slot, void* buffer, unsigned int offset, unsigned int size, bool vertexShader, bool pixelShader);
+		// The texture array is copied
+		void Bind_Textures(unsigned int startSlot, unsigned int textureCount, void* const* textures);
+		void DrawIndexed(unsigned int indexCount, unsigned int indexOffset, unsigned int vertexOffset);
+		void DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset);
+		//===============================================================================================================================
+
+		// Issues the recorded commands, in the order they were recorded
+		void Submit(RHI_Device* rhiDevice);
+
+		const std::vector<RHI_Command>& GetCommands()	{ return m_commands; }
+		bool IsEmpty()									{ return m_commands.empty(); }
+
+	private:
+		RHI_Command& Add(RHI_Command_Type type);
+
+		std::vector<RHI_Command> m_commands;
+		std::vector<void*> m_textures;
+	};
+}
\ No newline at end of file
@@ -32,6 +32,7 @@ namespace Directus
 	class RHI_Shader;
 	class RHI_Viewport;
 	class RHI_Shader;
+	class RHI_CommandList;
 
 	struct RHI_Vertex_PosUVTBN;
 	struct RHI_Vertex_PosUVNor;
@@ -125,11 +126,18 @@ namespace Directus
 	};
 }
 
-#ifdef API_D3D11
+#if defined(API_D3D11) || defined(API_NULL)
 // Forward declarations - Graphics API
 namespace Directus
 {
+	#ifdef API_D3D11
 	class D3D11_Device;
+	typedef D3D11_Device RHI;
+	#else
+	class Null_Device;
+	typedef Null_Device RHI;
+	#endif
+
 	class D3D11_ConstantBuffer;
 	class D3D11_Shader;
 	class D3D11_RenderTexture;
@@ -138,14 +146,13 @@ namespace Directus
 	class D3D11_VertexBuffer;
 	class D3D11_IndexBuffer;
 	class D3D11_Texture;
-	
-	typedef D3D11_Device RHI;
 }
 
 // Forward declarations - D3D11 API
 struct ID3D11DepthStencilView;
 struct ID3D11Device;
 struct ID3D11DeviceContext;
+struct ID3D11DeviceContext1;
 struct ID3D11ShaderResourceView;
 struct ID3D11InputLayout;
 struct ID3D11VertexShader;
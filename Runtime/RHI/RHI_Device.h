@@ -52,6 +52,7 @@ namespace Directus
 		//= RENDERING ============================================================================================================================
 		virtual void Draw(unsigned int vertexCount)																{ Profiler::Get().m_drawCalls++; }
 		virtual void DrawIndexed(unsigned int indexCount, unsigned int indexOffset, unsigned int vertexOffset)	{ Profiler::Get().m_drawCalls++; }
+		virtual void DrawIndexedInstanced(unsigned int indexCount, unsigned int instanceCount, unsigned int indexOffset, unsigned int vertexOffset) { Profiler::Get().m_drawCalls++; Profiler::Get().m_drawCallsInstanced++; }
 		virtual void Clear(const Math::Vector4& color) = 0;
 		virtual void Present(){}
 		//========================================================================================================================================
@@ -64,8 +65,18 @@ namespace Directus
 		void Bind_Texture(unsigned int startSlot, void* shaderResource) { Bind_Textures(startSlot, 1, &shaderResource); }
 		virtual void Bind_Samplers(unsigned int startSlot, unsigned int samplerCount, void* const* samplers) = 0;
 		void Bind_Sampler(unsigned int startSlot, void* sampler) { Bind_Samplers(startSlot, 1, &sampler); }
+		virtual void Bind_ConstantBuffer(unsigned int slot, void* buffer, unsigned int offset, unsigned int size, bool vertexShader, bool pixelShader) {}
 		//==================================================================================================================
 
+		//= CONSTANT BUFFERS =============================================================================
+		// Dynamic buffers which are sub-allocated (see RHI_UploadRing), offsets and sizes are multiples of 256 bytes
+		virtual void* ConstantBuffer_Create(unsigned int size)			{ return nullptr; }
+		virtual void ConstantBuffer_Release(void* buffer)				{}
+		virtual void* ConstantBuffer_Map(void* buffer, bool discard)	{ return nullptr; }
+		virtual void ConstantBuffer_Unmap(void* buffer)					{}
+		virtual bool ConstantBuffer_CanMapNoOverwrite()					{ return false; }
+		//================================================================================================
+
 		//= RESOLUTION ==================================
 		virtual bool SetResolution(int width, int height)
 		{
@@ -25,7 +25,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Backends/Backends.h"
 //===============================
 
-#ifdef API_D3D11
+#if defined(API_D3D11) || defined(API_NULL)
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "d3dcompiler.lib")
@@ -34,7 +34,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <d3d11_1.h>
 #include <d3dcompiler.h>
 #include <d3dcommon.h>
+#ifdef API_D3D11
 #include "D3D11/D3D11_Device.h"
+#else
+#include "Null/Null_Device.h"
+#endif
 
 static const D3D11_CULL_MODE d3d11_cull_mode[] =
 {
@@ -27,8 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "RHI_Implementation.h"
 #include "../Logging/Log.h"
 #include "../Core/Context.h"
-#include "../Scene/Components/Light.h"
-#include "../Scene/Components/Camera.h"
+#include "../Rendering/RenderSnapshot.h"
 //=====================================
 
 //= NAMESPACES ================
@@ -194,7 +193,7 @@ namespace Directus
 		SetBufferScope(m_constantBuffer.get(), slot);
 	}
 
-	void RHI_Shader::Bind_Buffer(const Matrix& mWVPortho, const Matrix& mWVPinv, const Matrix& mView, const Matrix& mProjection, const Vector2& resolution, Light* dirLight, Camera* camera, unsigned slot)
+	void RHI_Shader::Bind_Buffer(const Matrix& mWVPortho, const Matrix& mWVPinv, const Matrix& mView, const Matrix& mProjection, const Vector2& resolution, const RenderLight& dirLight, const RenderCamera& camera, unsigned slot)
 	{
 		if (!m_constantBuffer)
 		{
@@ -212,18 +211,18 @@ namespace Directus
 		buffer->projection				= mProjection;
 		buffer->projectionInverse		= mProjection.Inverted();
 
-		auto mLightView = dirLight->ComputeViewMatrix();
-		buffer->mLightViewProjection[0] = mLightView * dirLight->ShadowMap_ComputeProjectionMatrix(0);
-		buffer->mLightViewProjection[1] = mLightView * dirLight->ShadowMap_ComputeProjectionMatrix(1);
-		buffer->mLightViewProjection[2] = mLightView * dirLight->ShadowMap_ComputeProjectionMatrix(2);
+		for (unsigned int i = 0; i < 3; i++)
+		{
+			buffer->mLightViewProjection[i] = i < dirLight.projections.size() ? dirLight.view * dirLight.projections[i] : Matrix::Identity;
+		}
 
-		buffer->shadowSplits			= Vector4(dirLight->ShadowMap_GetSplit(0), dirLight->ShadowMap_GetSplit(1), 0, 0);
-		buffer->lightDir				= dirLight->GetDirection();
-		buffer->shadowMapResolution		= (float)dirLight->ShadowMap_GetResolution();
+		buffer->shadowSplits			= dirLight.splits;
+		buffer->lightDir				= dirLight.direction;
+		buffer->shadowMapResolution		= dirLight.shadowMapResolution;
 		buffer->resolution				= resolution;
-		buffer->nearPlane				= camera->GetNearPlane();
-		buffer->farPlane				= camera->GetFarPlane();
-		buffer->doShadowMapping			= dirLight->GetCastShadows();
+		buffer->nearPlane				= camera.nearPlane;
+		buffer->farPlane				= camera.farPlane;
+		buffer->doShadowMapping			= dirLight.castShadows;
 		buffer->padding					= Vector3::Zero;
 
 		// Unmap buffer
@@ -33,8 +33,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 namespace Directus
 {
 	class Context;
-	class Light;
-	class Camera;
+	struct RenderLight;
+	struct RenderCamera;
 
 	enum ConstantBufferType
 	{
@@ -78,8 +78,8 @@ namespace Directus
 			const Math::Matrix& mView, 
 			const Math::Matrix& mProjection,		
 			const Math::Vector2& vector2,
-			Light* dirLight,
-			Camera* camera,
+			const RenderLight& dirLight,
+			const RenderCamera& camera,
 			unsigned int slot = 0
 		);
 
@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Resource/ResourceManager.h"
 #include "../IO/FileStream.h"
 #include "../Core/EngineDefs.h"
+#include "../Rendering/TextureStreamer.h"
 //================================================
 
 //= NAMESPACES =====
@@ -37,6 +38,10 @@ using namespace std;
 
 namespace Directus
 {
+	// Engine textures start with this, followed by their size and mips (so that a tail of the mips can be read
+	// without the rest). Files without it are of the older layout, which has the mips first and is loaded whole.
+	static const unsigned int TEXTURE_FILE_STREAMABLE = 0x58544453;
+
 	static const char* textureTypeChar[] =
 	{
 		"Unknown",
@@ -77,7 +82,7 @@ namespace Directus
 	bool RHI_Texture::LoadFromFile(const string& rawFilePath)
 	{
 		bool loaded = false;
-		GetLoadState(LoadState_Started);
+		SetLoadState(LoadState_Started);
 
 		// Make the path, relative to the engine
 		auto filePath = FileSystem::GetRelativeFilePath(rawFilePath);
@@ -90,13 +95,15 @@ namespace Directus
 		// foreign format (most known image formats)
 		else if (FileSystem::IsSupportedImageFile(filePath))
 		{
-			loaded = LoadFromForeignFormat(filePath);
+			loaded			= LoadFromForeignFormat(filePath);
+			m_mipCount		= (unsigned int)m_textureBytes.size();
+			m_mipResident	= 0;
 		}
 
 		if (!loaded)
 		{
 			LOGF_ERROR("RI_Texture::LoadFromFile: Failed to load \"%s\".", filePath.c_str());
-			GetLoadState(LoadState_Failed);
+			SetLoadState(LoadState_Failed);
 			return false;
 		}
 
@@ -117,17 +124,17 @@ namespace Directus
 			}
 		}
 
-		GetLoadState(LoadState_Completed);
+		SetLoadState(LoadState_Completed);
 		return true;
 	}
 
-	unsigned int RHI_Texture::GetMemory()
+	unsigned long long RHI_Texture::GetMemory()
 	{
 		// Compute texture bits (in case they are loaded)
-		unsigned int size = 0;
+		unsigned long long size = 0;
 		for (const auto& mip : m_textureBytes)
 		{
-			size += (unsigned int)mip.size();
+			size += mip.size();
 		}
 
 		// Compute shader resource (in case it's created)
@@ -171,22 +178,50 @@ namespace Directus
 
 	void RHI_Texture::GetTextureBytes(vector<vector<std::byte>>* textureBytes)
 	{
-		if (!m_textureBytes.empty())
+		// All of the mips are in memory
+		if (!m_textureBytes.empty() && m_mipResident == 0)
 		{
-			textureBytes = &m_textureBytes;
+			if (textureBytes != &m_textureBytes)
+			{
+				*textureBytes = m_textureBytes;
+			}
 			return;
 		}
 
-		auto file = make_unique<FileStream>(m_resourceFilePath, FileStreamMode_Read);
-		if (!file->IsOpen())
-			return;
+		Deserialize_Mips(m_resourceFilePath, 0, textureBytes);
+	}
+	//================================================================================
 
-		unsigned int mipCount = file->ReadUInt();
-		for (unsigned int i = 0; i < mipCount; i++)
+	//= STREAMING ====================================================================
+	shared_ptr<D3D11_Texture> RHI_Texture::Stream_Load(unsigned int mip)
+	{
+		vector<vector<std::byte>> mips;
+		if (!m_isStreamable || !Deserialize_Mips(m_resourceFilePath, mip, &mips))
+		{
+			LOGF_ERROR("RHI_Texture::Stream_Load: Failed to read mip %d of \"%s\".", mip, m_resourceFilePath.c_str());
+			return nullptr;
+		}
+
+		auto shaderResource = make_shared<D3D11_Texture>(m_context->GetSubsystem<RHI>());
+		if (!shaderResource->CreateFromMipmaps(max(m_width >> mip, 1u), max(m_height >> mip, 1u), m_channels, mips, m_format))
 		{
-			textureBytes->emplace_back(vector<std::byte>());
-			file->Read(&m_textureBytes[i]);
+			LOGF_ERROR("RHI_Texture::Stream_Load: Failed to create shader resource for mip %d of \"%s\".", mip, m_resourceFilePath.c_str());
+			return nullptr;
 		}
+
+		return shaderResource;
+	}
+
+	void RHI_Texture::Stream_Apply(unsigned int mip, const shared_ptr<D3D11_Texture>& shaderResource)
+	{
+		if (!shaderResource)
+		{
+			m_isStreamable = false;
+			return;
+		}
+
+		m_textureLowLevel	= shaderResource;
+		m_mipResident		= mip;
 	}
 	//================================================================================
 
@@ -209,9 +244,13 @@ namespace Directus
 			return false;
 		}
 
+		// Only the mips from m_mipResident on might be loaded
+		unsigned int width	= max(m_width >> m_mipResident, 1u);
+		unsigned int height	= max(m_height >> m_mipResident, 1u);
+
 		if (m_isUsingMipmaps)
 		{
-			if (!m_textureLowLevel->CreateFromMipmaps(m_width, m_height, m_channels, m_textureBytes, m_format))
+			if (!m_textureLowLevel->CreateFromMipmaps(width, height, m_channels, m_textureBytes, m_format))
 			{
 				LOGF_ERROR("RI_Texture::CreateShaderResource: Failed to create shader resource with mipmaps for \"%s\".",  m_resourceFilePath.c_str());
 				return false;
@@ -219,7 +258,7 @@ namespace Directus
 		}
 		else
 		{
-			if (!m_textureLowLevel->Create(m_width, m_height, m_channels, m_textureBytes[0], m_format))
+			if (!m_textureLowLevel->Create(width, height, m_channels, m_textureBytes[0], m_format))
 			{
 				LOGF_ERROR("RI_Texture::CreateShaderResource: Failed to create shader resource for \"%s\".",  m_resourceFilePath.c_str());
 				return false;
@@ -297,6 +336,12 @@ namespace Directus
 		if (!file->IsOpen())
 			return false;
 
+		// Write what it takes to pick the mips to read
+		file->Write(TEXTURE_FILE_STREAMABLE);
+		file->Write(m_width);
+		file->Write(m_height);
+		file->Write(m_channels);
+
 		// Write texture bits
 		file->Write((unsigned int)m_textureBytes.size());
 		for (auto& mip : m_textureBytes)
@@ -307,9 +352,6 @@ namespace Directus
 		// Write properties
 		file->Write((int)m_type);
 		file->Write(m_bpp);
-		file->Write(m_width);
-		file->Write(m_height);
-		file->Write(m_channels);
 		file->Write(m_isGrayscale);
 		file->Write(m_isTransparent);
 		file->Write(m_isUsingMipmaps);
@@ -328,28 +370,90 @@ namespace Directus
 		if (!file->IsOpen())
 			return false;
 
-		// Read texture bits
 		ClearTextureBytes();
-		unsigned int mipCount = file->ReadUInt();
+		m_mipResident = 0;
+
+		// Streamable files start with the size, only the mips of the tail are read
+		unsigned int mipCount	= file->ReadUInt();
+		bool streamable			= mipCount == TEXTURE_FILE_STREAMABLE;
+		if (streamable)
+		{
+			file->Read(&m_width);
+			file->Read(&m_height);
+			file->Read(&m_channels);
+			mipCount		= file->ReadUInt();
+			m_mipResident	= TextureStreamer::ComputeMipTail(m_width, m_height, mipCount);
+		}
+
+		// Read texture bits
 		for (unsigned int i = 0; i < mipCount; i++)
 		{
+			if (i < m_mipResident)
+			{
+				file->Skip(file->ReadUInt());
+				continue;
+			}
+
 			m_textureBytes.emplace_back(vector<std::byte>());
-			file->Read(&m_textureBytes[i]);
+			file->Read(&m_textureBytes.back());
 		}
+		m_mipCount = mipCount;
 
 		// Read properties
 		m_type = (TextureType)file->ReadInt();
 		file->Read(&m_bpp);
-		file->Read(&m_width);
-		file->Read(&m_height);
-		file->Read(&m_channels);
+		if (!streamable)
+		{
+			file->Read(&m_width);
+			file->Read(&m_height);
+			file->Read(&m_channels);
+		}
 		file->Read(&m_isGrayscale);
 		file->Read(&m_isTransparent);
 		file->Read(&m_isUsingMipmaps);
 		file->Read(&m_resourceID);
-		file->Read(&m_resourceName);
-		file->Read(&m_resourceFilePath);
+
+		// Through the setters, the texture might already be cached under a different name
+		string name, path;
+		file->Read(&name);
+		file->Read(&path);
+		SetResourceName(name);
+		SetResourceFilePath(path);
+
+		m_isStreamable = streamable && m_isUsingMipmaps && m_mipCount > 1;
 
 		return true;
 	}
+
+	bool RHI_Texture::Deserialize_Mips(const string& filePath, unsigned int mipFirst, vector<vector<std::byte>>* mips)
+	{
+		auto file = make_unique<FileStream>(filePath, FileStreamMode_Read);
+		if (!file->IsOpen())
+			return false;
+
+		unsigned int mipCount = file->ReadUInt();
+		if (mipCount == TEXTURE_FILE_STREAMABLE)
+		{
+			file->Skip(3 * sizeof(unsigned int)); // Width, height and channels
+			mipCount = file->ReadUInt();
+		}
+
+		if (mipFirst >= mipCount)
+			return false;
+
+		mips->clear();
+		for (unsigned int i = 0; i < mipCount; i++)
+		{
+			if (i < mipFirst)
+			{
+				file->Skip(file->ReadUInt());
+				continue;
+			}
+
+			mips->emplace_back(vector<std::byte>());
+			file->Read(&mips->back());
+		}
+
+		return mips->size() == mipCount - mipFirst && !mips->back().empty();
+	}
 }
@@ -40,7 +40,7 @@ namespace Directus
 		//= RESOURCE INTERFACE =================================
 		bool SaveToFile(const std::string& filePath) override;
 		bool LoadFromFile(const std::string& filePath) override;
-		unsigned int GetMemory() override;
+		unsigned long long GetMemory() override;
 		//======================================================
 
 		//= PROPERTIES =======================================================================================
@@ -76,6 +76,20 @@ namespace Directus
 		void ClearTextureBytes();
 		void GetTextureBytes(std::vector<std::vector<std::byte>>* textureBytes);
 		//=====================================================================
+
+		//= STREAMING ========================================================================================================
+		// Engine textures with mipmaps load with their tail mips only, the renderer streams the rest in (and out) as needed
+		bool IsStreamable() { return m_isStreamable; }
+		unsigned int GetMipCount() { return m_mipCount; }
+		// The most detailed mip which is resident
+		unsigned int GetMipResident() { return m_mipResident; }
+		// Reads mips [mip, mip count) and creates a shader resource out of them. Safe to call from a worker,
+		// the texture is left as it is until the shader resource is handed to Stream_Apply().
+		std::shared_ptr<D3D11_Texture> Stream_Load(unsigned int mip);
+		// Makes the shader resource the texture's. Has to be called while the texture isn't being rendered (by the renderer).
+		// A null shader resource means that the mips failed to load, the texture then stops streaming.
+		void Stream_Apply(unsigned int mip, const std::shared_ptr<D3D11_Texture>& shaderResource);
+		//====================================================================================================================
 		
 		//= SHADER RESOURCE ============================
 		void** GetShaderResource() const;
@@ -95,6 +109,7 @@ namespace Directus
 		//= NATIVE TEXTURE HANDLING (BINARY) =========
 		bool Serialize(const std::string& filePath);
 		bool Deserialize(const std::string& filePath);
+		static bool Deserialize_Mips(const std::string& filePath, unsigned int mipFirst, std::vector<std::vector<std::byte>>* mips);
 		//============================================
 
 		bool LoadFromForeignFormat(const std::string& filePath);
@@ -111,6 +126,9 @@ namespace Directus
 		bool m_isGrayscale = false;
 		bool m_isTransparent = false;
 		bool m_isUsingMipmaps = false;
+		bool m_isStreamable = false;
+		unsigned int m_mipCount = 0;
+		unsigned int m_mipResident = 0; // The first of m_textureBytes (if they are loaded)
 		std::vector<std::vector<std::byte>> m_textureBytes;
 		TextureType m_type = TextureType_Unknown;
 		//=================================================
@@ -0,0 +1,192 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ================
+#include "RHI_UploadRing.h"
+#include "RHI_Device.h"
+#include "RHI_CommandList.h"
+#include "../Logging/Log.h"
+//===========================
+
+namespace Directus
+{
+	// Constant buffers can only be bound at offsets (and with sizes) which are a multiple of 16 constants
+	static const unsigned int UPLOAD_ALIGNMENT	= 256;
+	static const unsigned int UPLOAD_MAX_SIZE	= 64 * 1024 * 1024;
+
+	RHI_UploadRing::RHI_UploadRing(RHI_Device* rhiDevice, unsigned int size)
+	{
+		m_rhiDevice	= rhiDevice;
+		m_buffer	= nullptr;
+		m_mapped	= nullptr;
+		m_size		= 0;
+		m_head		= 0;
+		m_full		= false;
+		m_grow		= false;
+
+		Create(size);
+	}
+
+	RHI_UploadRing::~RHI_UploadRing()
+	{
+		End();
+		m_rhiDevice->ConstantBuffer_Release(m_buffer);
+	}
+
+	void RHI_UploadRing::NewFrame()
+	{
+		if (m_mapped)
+		{
+			LOG_WARNING("RHI_UploadRing::NewFrame: The previous frame didn't unmap the ring.");
+			End();
+		}
+
+		if (m_grow && m_size < UPLOAD_MAX_SIZE)
+		{
+			Create(m_size * 2);
+		}
+
+		m_head	= 0;
+		m_full	= false;
+		m_grow	= false;
+	}
+
+	bool RHI_UploadRing::Begin(unsigned int reserve)
+	{
+		if (!m_buffer)
+			return false;
+
+		if (m_mapped)
+			return true;
+
+		// Keep appending if what was already allocated this frame can be left alone,
+		// otherwise discard (the GPU keeps reading the previous contents) and start over.
+		unsigned int reserveAligned	= (reserve + UPLOAD_ALIGNMENT - 1) & ~(UPLOAD_ALIGNMENT - 1);
+		bool discard				= m_head == 0 || m_full || reserveAligned > m_size - m_head || !m_rhiDevice->ConstantBuffer_CanMapNoOverwrite();
+		if (discard)
+		{
+			m_grow = m_grow || reserveAligned > m_size - m_head;
+			m_head = 0;
+			m_full = false;
+		}
+
+		m_mapped = (unsigned char*)m_rhiDevice->ConstantBuffer_Map(m_buffer, discard);
+		if (!m_mapped)
+		{
+			LOG_ERROR("RHI_UploadRing::Begin: Failed to map.");
+			return false;
+		}
+
+		return true;
+	}
+
+	void RHI_UploadRing::End()
+	{
+		if (!m_mapped)
+			return;
+
+		m_rhiDevice->ConstantBuffer_Unmap(m_buffer);
+		m_mapped = nullptr;
+	}
+
+	RHI_UploadAllocation RHI_UploadRing::Allocate(unsigned int size)
+	{
+		RHI_UploadAllocation allocation;
+		if (!m_mapped || size == 0)
+			return allocation;
+
+		unsigned int sizeAligned = (size + UPLOAD_ALIGNMENT - 1) & ~(UPLOAD_ALIGNMENT - 1);
+		if (sizeAligned > m_size - m_head)
+		{
+			m_full = true;
+			m_grow = true;
+			return allocation;
+		}
+
+		allocation.data		= m_mapped + m_head;
+		allocation.offset	= m_head;
+		allocation.size		= sizeAligned;
+		m_head				+= sizeAligned;
+
+		return allocation;
+	}
+
+	void RHI_UploadRing::SetVS(unsigned int slot, const RHI_UploadAllocation& allocation)
+	{
+		m_rhiDevice->Bind_ConstantBuffer(slot, m_buffer, allocation.offset, allocation.size, true, false);
+	}
+
+	void RHI_UploadRing::SetPS(unsigned int slot, const RHI_UploadAllocation& allocation)
+	{
+		m_rhiDevice->Bind_ConstantBuffer(slot, m_buffer, allocation.offset, allocation.size, false, true);
+	}
+
+	void RHI_UploadRing::SetVS(RHI_CommandList* commandList, unsigned int slot, const RHI_UploadAllocation& allocation)
+	{
+		commandList->Bind_ConstantBuffer(slot, m_buffer, allocation.offset, allocation.size, true, false);
+	}
+
+	void RHI_UploadRing::SetPS(RHI_CommandList* commandList, unsigned int slot, const RHI_UploadAllocation& allocation)
+	{
+		commandList->Bind_ConstantBuffer(slot, m_buffer, allocation.offset, allocation.size, false, true);
+	}
+
+	RHI_UploadAllocation RHI_UploadRing::Allocate(RHI_UploadAllocation* block, unsigned int size)
+	{
+		RHI_UploadAllocation allocation;
+		if (!block || !block->data || size == 0)
+			return allocation;
+
+		unsigned int sizeAligned = GetAlignedSize(size);
+		if (sizeAligned > block->size)
+			return allocation;
+
+		allocation.data		= block->data;
+		allocation.offset	= block->offset;
+		allocation.size		= sizeAligned;
+
+		block->data		= (unsigned char*)block->data + sizeAligned;
+		block->offset	+= sizeAligned;
+		block->size		-= sizeAligned;
+
+		return allocation;
+	}
+
+	unsigned int RHI_UploadRing::GetAlignedSize(unsigned int size)
+	{
+		return (size + UPLOAD_ALIGNMENT - 1) & ~(UPLOAD_ALIGNMENT - 1);
+	}
+
+	bool RHI_UploadRing::Create(unsigned int size)
+	{
+		m_rhiDevice->ConstantBuffer_Release(m_buffer);
+		m_size		= (size + UPLOAD_ALIGNMENT - 1) & ~(UPLOAD_ALIGNMENT - 1);
+		m_buffer	= m_rhiDevice->ConstantBuffer_Create(m_size);
+		if (!m_buffer)
+		{
+			LOG_ERROR("RHI_UploadRing::Create: Failed to create a " + std::to_string(m_size) + " byte buffer.");
+			m_size = 0;
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,85 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==================
+#include "../Core/EngineDefs.h"
+//=============================
+
+namespace Directus
+{
+	class RHI_Device;
+	class RHI_CommandList;
+
+	// A sub-allocation, valid until the ring is unmapped (data) and until the next frame (offset)
+	struct RHI_UploadAllocation
+	{
+		void* data			= nullptr;
+		unsigned int offset	= 0;
+		unsigned int size	= 0;
+	};
+
+	// One large constant buffer, per-frame data is linearly sub-allocated from it, written once and bound by offset.
+	// Usage: NewFrame() once per frame, then Begin(), Allocate() and write as much as needed, End(), and bind.
+	class ENGINE_CLASS RHI_UploadRing
+	{
+	public:
+		RHI_UploadRing(RHI_Device* rhiDevice, unsigned int size);
+		~RHI_UploadRing();
+
+		// Rewinds, what the previous frame allocated is discarded. Grows if the previous frame ran out of space.
+		void NewFrame();
+
+		// Maps the buffer, allocations are only possible in between. Starts over if there isn't room for what's reserved.
+		bool Begin(unsigned int reserve = 0);
+		void End();
+
+		// Returns an allocation without data if the ring is full (or not mapped), End() and Begin() again to start over
+		RHI_UploadAllocation Allocate(unsigned int size);
+
+		void SetVS(unsigned int slot, const RHI_UploadAllocation& allocation);
+		void SetPS(unsigned int slot, const RHI_UploadAllocation& allocation);
+		void SetVS(RHI_CommandList* commandList, unsigned int slot, const RHI_UploadAllocation& allocation);
+		void SetPS(RHI_CommandList* commandList, unsigned int slot, const RHI_UploadAllocation& allocation);
+
+		// Carves an allocation off the front of a block (a large allocation), so that threads can sub-allocate
+		// from blocks of their own without touching the ring. Returns an allocation without data if the block ran out.
+		static RHI_UploadAllocation Allocate(RHI_UploadAllocation* block, unsigned int size);
+		// What an allocation of the given size occupies
+		static unsigned int GetAlignedSize(unsigned int size);
+
+		unsigned int GetSize()	{ return m_size; }
+		unsigned int GetUsed()	{ return m_head; }
+		bool IsMapped()			{ return m_mapped != nullptr; }
+
+	private:
+		bool Create(unsigned int size);
+
+		RHI_Device* m_rhiDevice;
+		void* m_buffer;
+		unsigned char* m_mapped;
+		unsigned int m_size;
+		unsigned int m_head;
+		bool m_full;
+		bool m_grow;
+	};
+}
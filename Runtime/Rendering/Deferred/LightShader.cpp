@@ -22,13 +22,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ====================================
 #include "LightShader.h"
 #include "../../Logging/Log.h"
-#include "../../Scene/Components/Transform.h"
-#include "../../Scene/Components/Light.h"
 #include "../../Core/Settings.h"
 #include "../../RHI/RHI_Implementation.h"
 #include "../../RHI/D3D11//D3D11_RenderTexture.h"
 #include "../../RHI/D3D11/D3D11_ConstantBuffer.h"
 #include "../../RHI/D3D11/D3D11_Shader.h"
+#include "../../RHI/RHI_UploadRing.h"
 //===============================================
 
 //= NAMESPACES ================
@@ -60,10 +59,6 @@ namespace Directus
 		// Create matrix buffer
 		m_matrixBuffer = make_shared<D3D11_ConstantBuffer>(m_rhi);
 		m_matrixBuffer->Create(sizeof(MatrixBufferType));
-
-		// Create misc buffer
-		m_miscBuffer = make_shared<D3D11_ConstantBuffer>(m_rhi);
-		m_miscBuffer->Create(sizeof(MiscBufferType));
 	}
 
 	void LightShader::UpdateMatrixBuffer(const Matrix& mWorld, const Matrix& mView, const Matrix& mBaseView, const Matrix& mPerspectiveProjection, const Matrix& mOrthographicProjection)
@@ -95,7 +90,7 @@ namespace Directus
 		m_matrixBuffer->SetPS(0);
 	}
 
-	void LightShader::UpdateMiscBuffer(const vector<Light*>& lights, Camera* camera)
+	void LightShader::UpdateMiscBuffer(const vector<RenderLight>& lights, const RenderCamera& camera, RHI_UploadRing* ring)
 	{
 		if (!IsCompiled())
 		{
@@ -103,39 +98,39 @@ namespace Directus
 			return;
 		}
 
-		if (!camera || lights.empty())
+		if (lights.empty())
 			return;
 
-		// Get a pointer to the data in the constant buffer.
-		auto buffer = (MiscBufferType*)m_miscBuffer->Map();
+		// Sub-allocate from the ring
+		if (!ring->Begin(sizeof(MiscBufferType)))
+			return;
+		RHI_UploadAllocation allocation = ring->Allocate(sizeof(MiscBufferType));
+		auto buffer = (MiscBufferType*)allocation.data;
+		if (!buffer)
+		{
+			ring->End();
+			LOG_ERROR("Failed to allocate the misc buffer.");
+			return;
+		}
 
-		Vector3 camPos = camera->GetTransform()->GetPosition();
+		Vector3 camPos = camera.position;
 		buffer->cameraPosition = Vector4(camPos.x, camPos.y, camPos.z, 1.0f);
 
-		// Reset any light buffer values because the shader will still use them
+		// Only the lights up to the counts are read by the shader, but the directional light always is
 		buffer->dirLightColor = Vector4::Zero;
 		buffer->dirLightDirection = Vector4::Zero;
 		buffer->dirLightIntensity = Vector4::Zero;
-		for (int i = 0; i < maxLights; i++)
-		{
-			buffer->pointLightPosition[i]		= Vector4::Zero;
-			buffer->pointLightColor[i]			= Vector4::Zero;
-			buffer->pointLightIntenRange[i]		= Vector4::Zero;
-			buffer->spotLightPosition[i]		= Vector4::Zero;
-			buffer->spotLightColor[i]			= Vector4::Zero;
-			buffer->spotLightIntenRangeAngle[i] = Vector4::Zero;
-		}
 
 		// Fill with directional lights
 		for (const auto& light : lights)
 		{
-			if (light->GetLightType() != LightType_Directional)
+			if (light.type != LightType_Directional)
 				continue;
 
-			Vector3 direction = light->GetDirection();
+			Vector3 direction = light.direction;
 
-			buffer->dirLightColor = light->GetColor();	
-			buffer->dirLightIntensity = Vector4(light->GetIntensity());
+			buffer->dirLightColor = light.color;	
+			buffer->dirLightIntensity = Vector4(light.intensity);
 			buffer->dirLightDirection = Vector4(direction.x, direction.y, direction.z, 0.0f);
 		}
 
@@ -143,13 +138,16 @@ namespace Directus
 		int pointIndex = 0;
 		for (const auto& light : lights)
 		{
-			if (light->GetLightType() != LightType_Point)
+			if (light.type != LightType_Point)
 				continue;
 
-			Vector3 pos = light->GetTransform()->GetPosition();
+			if (pointIndex == maxLights)
+				break;
+
+			Vector3 pos = light.position;
 			buffer->pointLightPosition[pointIndex] = Vector4(pos.x, pos.y, pos.z, 1.0f);
-			buffer->pointLightColor[pointIndex] = light->GetColor();
-			buffer->pointLightIntenRange[pointIndex] = Vector4(light->GetIntensity(), light->GetRange(), 0.0f, 0.0f);
+			buffer->pointLightColor[pointIndex] = light.color;
+			buffer->pointLightIntenRange[pointIndex] = Vector4(light.intensity, light.range, 0.0f, 0.0f);
 
 			pointIndex++;
 		}
@@ -158,33 +156,35 @@ namespace Directus
 		int spotIndex = 0;
 		for (const auto& light : lights)
 		{
-			if (light->GetLightType() != LightType_Spot)
+			if (light.type != LightType_Spot)
 				continue;
 
-			Vector3 direction = light->GetDirection();
-			Vector3 pos = light->GetTransform()->GetPosition();
+			if (spotIndex == maxLights)
+				break;
+
+			Vector3 direction = light.direction;
+			Vector3 pos = light.position;
 
-			buffer->spotLightColor[spotIndex] = light->GetColor();
+			buffer->spotLightColor[spotIndex] = light.color;
 			buffer->spotLightPosition[spotIndex] = Vector4(pos.x, pos.y, pos.z, 1.0f);
 			buffer->spotLightDirection[spotIndex] = Vector4(direction.x, direction.y, direction.z, 0.0f);
-			buffer->spotLightIntenRangeAngle[spotIndex] = Vector4(light->GetIntensity(), light->GetRange(), light->GetAngle(), 0.0f);
+			buffer->spotLightIntenRangeAngle[spotIndex] = Vector4(light.intensity, light.range, light.angle, 0.0f);
 
 			spotIndex++;
 		}
 
 		buffer->pointLightCount = (float)pointIndex;
 		buffer->spotLightCount = (float)spotIndex;
-		buffer->nearPlane = camera->GetNearPlane();
-		buffer->farPlane = camera->GetFarPlane();
+		buffer->nearPlane = camera.nearPlane;
+		buffer->farPlane = camera.farPlane;
 		buffer->viewport = Settings::Get().GetResolution();
 		buffer->padding = Vector2::Zero;
 
-		// Unmap buffer
-		m_miscBuffer->Unmap();
+		ring->End();
 
 		// Set to shader slot
-		m_miscBuffer->SetVS(1);
-		m_miscBuffer->SetPS(1);
+		ring->SetVS(1, allocation);
+		ring->SetPS(1, allocation);
 	}
 
 	void LightShader::Bind()
@@ -25,13 +25,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../../RHI/RHI_Definition.h"
 #include "../../Math/Matrix.h"
 #include "../../Math/Vector4.h"
-#include "../../Scene/Components/Camera.h"
-#include "../../Scene/Components/Light.h"
 #include "../../Resource/ResourceManager.h"
+#include "../RenderSnapshot.h"
 //=========================================
 
 namespace Directus
 {
+	class RHI_UploadRing;
+
 	class LightShader
 	{
 	public:
@@ -41,7 +42,7 @@ namespace Directus
 		void Compile(const std::string& filePath, RHI* rhi);
 		void UpdateMatrixBuffer(const Math::Matrix& mWorld, const Math::Matrix& mView, const Math::Matrix& mBaseView,
 			const Math::Matrix& mPerspectiveProjection, const Math::Matrix& mOrthographicProjection);
-		void UpdateMiscBuffer(const std::vector<Light*>& lights, Camera* camera);
+		void UpdateMiscBuffer(const std::vector<RenderLight>& lights, const RenderCamera& camera, RHI_UploadRing* ring);
 		void Bind();
 		bool IsCompiled();
 
@@ -90,7 +91,6 @@ namespace Directus
 		};
 
 		std::shared_ptr<D3D11_ConstantBuffer> m_matrixBuffer;
-		std::shared_ptr<D3D11_ConstantBuffer> m_miscBuffer;
 		std::shared_ptr<D3D11_Shader> m_shader;
 		RHI* m_rhi;
 	};
@@ -22,14 +22,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ====================================
 #include "ShaderVariation.h"
 #include "../Material.h"
-#include "../../RHI/D3D11/D3D11_Device.h"
-#include "../../RHI/D3D11/D3D11_ConstantBuffer.h"
 #include "../../RHI/D3D11/D3D11_Shader.h"
 #include "../../RHI/RHI_Implementation.h"
+#include "../../RHI/RHI_UploadRing.h"
+#include "../../RHI/RHI_CommandList.h"
 #include "../../Logging/Log.h"
 #include "../../Core/Settings.h"
-#include "../../Scene/Components/Transform.h"
-#include "../../Scene/Components/Camera.h"
 //===============================================
 
 //= NAMESPACES ================
@@ -68,134 +66,97 @@ namespace Directus
 		AddDefinesBasedOnMaterial(m_D3D11Shader);
 		m_D3D11Shader->Compile(filePath);
 		m_D3D11Shader->SetInputLayout(Input_PositionTextureTBN);
-
-		// Matrix Buffer
-		m_perObjectBuffer = make_shared<D3D11_ConstantBuffer>(m_rhi);
-		m_perObjectBuffer->Create(sizeof(PerObjectBufferType));
-
-		// Object Buffer
-		m_materialBuffer = make_shared<D3D11_ConstantBuffer>(m_rhi);
-		m_materialBuffer->Create(sizeof(PerMaterialBufferType));
-
-		// Object Buffer
-		m_miscBuffer = make_shared<D3D11_ConstantBuffer>(m_rhi);
-		m_miscBuffer->Create(sizeof(PerFrameBufferType));
 	}
 
-	void ShaderVariation::Bind()
+	bool ShaderVariation::Bind(RHI_CommandList* commandList)
 	{
-		if (!m_D3D11Shader)
-		{
-			LOG_WARNING("Can't set uninitialized shader");
-			return;
-		}
+		if (!m_D3D11Shader || !m_D3D11Shader->IsCompiled())
+			return false;
 
-		m_D3D11Shader->Bind();
+		commandList->Bind_Shader(m_D3D11Shader.get());
+		return true;
 	}
 
-	void ShaderVariation::Bind_PerFrameBuffer(Camera* camera)
+	bool ShaderVariation::Upload_PerFrameBuffer(RHI_UploadAllocation* block, const Vector3& cameraPosition, RHI_UploadAllocation* allocation)
 	{
-		if (!m_D3D11Shader || !m_D3D11Shader->IsCompiled())
-		{
-			LOG_ERROR("Shader hasn't been loaded or failed to compile. Can't update per frame buffer.");
-			return;
-		}
-
-		if (!camera)
-			return;
+		*allocation = RHI_UploadRing::Allocate(block, sizeof(PerFrameBufferType));
+		if (!allocation->data)
+			return false;
 
-		//= BUFFER UPDATE ==========================================
-		auto buffer = (PerFrameBufferType*)m_miscBuffer->Map();
-
-		buffer->cameraPos	= camera->GetTransform()->GetPosition();
+		auto buffer			= (PerFrameBufferType*)allocation->data;
+		buffer->cameraPos	= cameraPosition;
 		buffer->padding		= 0.0f;
 		buffer->viewport	= Settings::Get().GetResolution();
 		buffer->padding2	= Vector2::Zero;
-		
-		m_miscBuffer->Unmap();
-		//==========================================================
 
-		// Set to shader slot
-		m_miscBuffer->SetPS(0);
+		return true;
 	}
 
-	void ShaderVariation::Bind_PerMaterialBuffer(Material* material)
+	bool ShaderVariation::Upload_PerMaterialBuffer(RHI_UploadAllocation* block, Material* material, RHI_UploadAllocation* allocation)
 	{
-		if (!material)
-			return;
+		*allocation = RHI_UploadRing::Allocate(block, sizeof(PerMaterialBufferType));
+		if (!allocation->data)
+			return false;
+
+		auto buffer				= (PerMaterialBufferType*)allocation->data;
+		buffer->matAlbedo		= material->GetColorAlbedo();
+		buffer->matTilingUV		= material->GetTiling();
+		buffer->matOffsetUV		= material->GetOffset();
+		buffer->matRoughnessMul	= material->GetRoughnessMultiplier();
+		buffer->matMetallicMul	= material->GetMetallicMultiplier();
+		buffer->matNormalMul	= material->GetNormalMultiplier();
+		buffer->matHeightMul	= material->GetHeightMultiplier();
+		buffer->matShadingMode	= float(material->GetShadingMode());
+		buffer->paddding		= Vector3::Zero;
+
+		return true;
+	}
 
-		if (!m_D3D11Shader->IsCompiled())
-		{
-			LOG_ERROR("Shader hasn't been loaded or failed to compile. Can't update per material buffer.");
-			return;
-		}
+	Matrix* ShaderVariation::Upload_PerObjectBuffer(RHI_UploadAllocation* block, unsigned int instanceCount, const Matrix& mView, const Matrix& mViewProjection, RHI_UploadAllocation* allocation)
+	{
+		if (instanceCount == 0 || instanceCount > SHADER_MAX_INSTANCES)
+			return nullptr;
 
-		// Determine if the material buffer needs to update
-		bool update = false;
-		update = perMaterialBufferCPU.matAlbedo			!= material->GetColorAlbedo()			? true : update;
-		update = perMaterialBufferCPU.matTilingUV		!= material->GetTiling()				? true : update;
-		update = perMaterialBufferCPU.matOffsetUV		!= material->GetOffset()				? true : update;
-		update = perMaterialBufferCPU.matRoughnessMul	!= material->GetRoughnessMultiplier()	? true : update;
-		update = perMaterialBufferCPU.matMetallicMul	!= material->GetMetallicMultiplier()	? true : update;
-		update = perMaterialBufferCPU.matNormalMul		!= material->GetNormalMultiplier()		? true : update;
-		update = perMaterialBufferCPU.matShadingMode	!= float(material->GetShadingMode())	? true : update;
-
-		if (update)
-		{
-			//= BUFFER UPDATE ===================================================================================
-			auto buffer = (PerMaterialBufferType*)m_materialBuffer->Map();
-
-			buffer->matAlbedo		= perMaterialBufferCPU.matAlbedo		= material->GetColorAlbedo();
-			buffer->matTilingUV		= perMaterialBufferCPU.matTilingUV		= material->GetTiling();
-			buffer->matOffsetUV		= perMaterialBufferCPU.matOffsetUV		= material->GetOffset();
-			buffer->matRoughnessMul = perMaterialBufferCPU.matRoughnessMul	= material->GetRoughnessMultiplier();
-			buffer->matMetallicMul	= perMaterialBufferCPU.matMetallicMul	= material->GetMetallicMultiplier();
-			buffer->matNormalMul	= perMaterialBufferCPU.matNormalMul		= material->GetNormalMultiplier();
-			buffer->matHeightMul	= perMaterialBufferCPU.matNormalMul		= material->GetHeightMultiplier();
-			buffer->matShadingMode	= perMaterialBufferCPU.matShadingMode	= float(material->GetShadingMode());
-			buffer->paddding		= Vector3::Zero;
-
-			m_materialBuffer->Unmap();
-			//===================================================================================================
-		}
+		// Only as many world matrices as there are instances
+		*allocation = RHI_UploadRing::Allocate(block, GetUploadSize_PerObject(instanceCount));
+		if (!allocation->data)
+			return nullptr;
+
+		auto* buffer			= (PerObjectBufferType*)allocation->data;
+		buffer->mView			= mView;
+		buffer->mViewProjection	= mViewProjection;
 
-		// Set to shader slot
-		m_materialBuffer->SetPS(1);
+		return buffer->mWorld;
 	}
 
-	void ShaderVariation::Bind_PerObjectBuffer(const Matrix& mWorld, const Matrix& mView, const Matrix& mProjection)
+	void ShaderVariation::Bind_PerFrameBuffer(RHI_CommandList* commandList, RHI_UploadRing* ring, const RHI_UploadAllocation& allocation)
 	{
-		if (!m_D3D11Shader->IsCompiled())
-		{
-			LOG_ERROR("Shader hasn't been loaded or failed to compile. Can't update per object buffer.");
-			return;
-		}
-
-		Matrix world				= mWorld;
-		Matrix worldView			= mWorld * mView;
-		Matrix worldViewProjection	= worldView * mProjection;
+		ring->SetPS(commandList, 0, allocation);
+	}
 
-		// Determine if the buffer actually needs to update
-		bool update = false;
-		update = perObjectBufferCPU.mWorld					!= world ? true : update;
-		update = perObjectBufferCPU.mWorldView				!= worldView ? true : update;
-		update = perObjectBufferCPU.mWorldViewProjection	!= worldViewProjection ? true : update;
+	void ShaderVariation::Bind_PerMaterialBuffer(RHI_CommandList* commandList, RHI_UploadRing* ring, const RHI_UploadAllocation& allocation)
+	{
+		ring->SetPS(commandList, 1, allocation);
+	}
 
-		if (update)
-		{
-			//= BUFFER UPDATE ============================================================================
-			auto* buffer = (PerObjectBufferType*)m_perObjectBuffer->Map();
+	void ShaderVariation::Bind_PerObjectBuffer(RHI_CommandList* commandList, RHI_UploadRing* ring, const RHI_UploadAllocation& allocation)
+	{
+		ring->SetVS(commandList, 2, allocation);
+	}
 
-			buffer->mWorld = perObjectBufferCPU.mWorld								= world;
-			buffer->mWorldView = perObjectBufferCPU.mWorldView						= worldView;
-			buffer->mWorldViewProjection = perObjectBufferCPU.mWorldViewProjection	= worldViewProjection;
+	unsigned int ShaderVariation::GetUploadSize_PerFrame()
+	{
+		return RHI_UploadRing::GetAlignedSize(sizeof(PerFrameBufferType));
+	}
 
-			m_perObjectBuffer->Unmap();
-			//============================================================================================
-		}
+	unsigned int ShaderVariation::GetUploadSize_PerMaterial()
+	{
+		return RHI_UploadRing::GetAlignedSize(sizeof(PerMaterialBufferType));
+	}
 
-		// Set to shader slot
-		m_perObjectBuffer->SetVS(2);
+	unsigned int ShaderVariation::GetUploadSize_PerObject(unsigned int instanceCount)
+	{
+		return RHI_UploadRing::GetAlignedSize(sizeof(PerObjectBufferType) - sizeof(Matrix) * (SHADER_MAX_INSTANCES - instanceCount));
 	}
 
 	void ShaderVariation::AddDefinesBasedOnMaterial(const shared_ptr<D3D11_Shader>& shader)
@@ -31,9 +31,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace Directus
 {
-	class Light;
-	class Camera;
 	class Material;
+	class RHI_UploadRing;
+	struct RHI_UploadAllocation;
+
+	// World matrices per instanced draw, must match GBuffer.hlsl
+	static const unsigned int SHADER_MAX_INSTANCES = 256;
 
 	enum ShaderFlags : unsigned long
 	{
@@ -57,10 +60,22 @@ namespace Directus
 
 		void Compile(const std::string& filePath, unsigned long shaderFlags);
 
-		void Bind();
-		void Bind_PerFrameBuffer(Camera* camera);
-		void Bind_PerMaterialBuffer(Material* material);
-		void Bind_PerObjectBuffer(const Math::Matrix& mWorld, const Math::Matrix& mView, const Math::Matrix& mProjection);
+		//= RECORDING ================================================================================================================================================
+		// Everything is recorded into command lists and the buffers are sub-allocated from blocks of the upload ring (see RHI_UploadRing::Allocate),
+		// so that chunks of the G-Buffer pass can be recorded on different threads. Returns false if the shader can't be bound.
+		bool Bind(RHI_CommandList* commandList);
+		static bool Upload_PerFrameBuffer(RHI_UploadAllocation* block, const Math::Vector3& cameraPosition, RHI_UploadAllocation* allocation);
+		static bool Upload_PerMaterialBuffer(RHI_UploadAllocation* block, Material* material, RHI_UploadAllocation* allocation);
+		// Returns where the world matrices of the instances go
+		static Math::Matrix* Upload_PerObjectBuffer(RHI_UploadAllocation* block, unsigned int instanceCount, const Math::Matrix& mView, const Math::Matrix& mViewProjection, RHI_UploadAllocation* allocation);
+		static void Bind_PerFrameBuffer(RHI_CommandList* commandList, RHI_UploadRing* ring, const RHI_UploadAllocation& allocation);
+		static void Bind_PerMaterialBuffer(RHI_CommandList* commandList, RHI_UploadRing* ring, const RHI_UploadAllocation& allocation);
+		static void Bind_PerObjectBuffer(RHI_CommandList* commandList, RHI_UploadRing* ring, const RHI_UploadAllocation& allocation);
+		// How much of a block the uploads take
+		static unsigned int GetUploadSize_PerFrame();
+		static unsigned int GetUploadSize_PerMaterial();
+		static unsigned int GetUploadSize_PerObject(unsigned int instanceCount);
+		//============================================================================================================================================================
 
 		unsigned long GetShaderFlags()	{ return m_shaderFlags; }
 		bool HasAlbedoTexture()			{ return m_shaderFlags & Variaton_Albedo; }
@@ -81,9 +96,6 @@ namespace Directus
 
 		//= MISC ==================================================
 		RHI* m_rhi;
-		std::shared_ptr<D3D11_ConstantBuffer> m_perObjectBuffer;
-		std::shared_ptr<D3D11_ConstantBuffer> m_materialBuffer;
-		std::shared_ptr<D3D11_ConstantBuffer> m_miscBuffer;
 		std::shared_ptr<D3D11_Shader> m_D3D11Shader;
 
 		//= BUFFERS ===============================================
@@ -108,15 +120,13 @@ namespace Directus
 			float matShadingMode;
 			Math::Vector3 paddding;
 		};
-		PerMaterialBufferType perMaterialBufferCPU;
 
 		struct PerObjectBufferType
 		{
-			Math::Matrix mWorld;
-			Math::Matrix mWorldView;
-			Math::Matrix mWorldViewProjection;
+			Math::Matrix mView;
+			Math::Matrix mViewProjection;
+			Math::Matrix mWorld[SHADER_MAX_INSTANCES]; // Indexed by the instance ID, only the ones drawn are uploaded
 		};
-		PerObjectBufferType perObjectBufferCPU;
 		//==========================================================
 	};
 }
\ No newline at end of file
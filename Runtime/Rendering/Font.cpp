@@ -25,7 +25,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../RHI/RHI_Vertex.h"
 #include "../RHI/D3D11/D3D11_VertexBuffer.h"
 #include "../RHI/D3D11/D3D11_IndexBuffer.h"
-#include "../RHI/D3D11/D3D11_Device.h"
 #include "../RHI/RHI_Texture.h"
 #include "../RHI/RHI_Implementation.h"
 #include "../Core/Settings.h"
@@ -51,6 +50,8 @@ namespace Directus
 		m_charMaxWidth	= 0;
 		m_charMaxHeight = 0;
 		m_fontColor		= color;
+		m_vertexBufferCapacity	= 0;
+		m_indexBufferCapacity	= 0;
 		
 		SetSize(fontSize);
 		LoadFromFile(filePath);
@@ -193,31 +194,40 @@ namespace Directus
 		if (!m_context)
 			return false;
 
+		if (vertices.empty() || indices.empty())
+			return false;
+
 		// Vertex buffer
-		if (!m_vertexBuffer)
+		if (!m_vertexBuffer || vertices.size() > m_vertexBufferCapacity)
 		{
-			m_vertexBuffer = make_shared<D3D11_VertexBuffer>(rhi);
-			if (!m_vertexBuffer->CreateDynamic(sizeof(RHI_Vertex_PosUV), (unsigned int)vertices.size()))
+			m_vertexBufferCapacity	= (unsigned int)vertices.size() * 2;
+			m_vertexBuffer			= make_shared<D3D11_VertexBuffer>(rhi);
+			if (!m_vertexBuffer->CreateDynamic(sizeof(RHI_Vertex_PosUV), m_vertexBufferCapacity))
 			{
 				LOG_ERROR("Font: Failed to create vertex buffer.");
 				return false;
 			}	
 		}
 		void* data = m_vertexBuffer->Map();
+		if (!data)
+			return false;
 		memcpy(data, &vertices[0], sizeof(RHI_Vertex_PosUV) * vertices.size());
 		m_vertexBuffer->Unmap();
 
 		// Index buffer
-		if (!m_indexBuffer)
+		if (!m_indexBuffer || indices.size() > m_indexBufferCapacity)
 		{
-			m_indexBuffer = make_shared<D3D11_IndexBuffer>(rhi);
-			if (!m_indexBuffer->CreateDynamic((unsigned int)indices.size()))
+			m_indexBufferCapacity	= (unsigned int)indices.size() * 2;
+			m_indexBuffer			= make_shared<D3D11_IndexBuffer>(rhi);
+			if (!m_indexBuffer->CreateDynamic(m_indexBufferCapacity))
 			{
 				LOG_ERROR("Font: Failed to create index buffer.");
 				return false;
 			}
 		}
 		data = m_indexBuffer->Map();
+		if (!data)
+			return false;
 		memcpy(data, &indices[0], sizeof(unsigned int) * indices.size());
 		m_indexBuffer->Unmap();
 
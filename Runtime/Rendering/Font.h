@@ -72,6 +72,8 @@ namespace Directus
 		Math::Vector4 m_fontColor;
 		std::shared_ptr<D3D11_VertexBuffer> m_vertexBuffer;
 		std::shared_ptr<D3D11_IndexBuffer> m_indexBuffer;
+		unsigned int m_vertexBufferCapacity;	// The text changes, the buffers are recreated only when it doesn't fit
+		unsigned int m_indexBufferCapacity;
 		std::vector<RHI_Vertex_PosUV> m_vertices;
 		std::vector<unsigned int> m_indices;
 		std::string m_currentText;
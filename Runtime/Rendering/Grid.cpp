@@ -23,7 +23,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Grid.h"
 #include "../Core/Context.h"
 #include "../Logging/Log.h"
-#include "../Scene/Components/Transform.h"
 #include "../RHI/RHI_Vertex.h"
 #include "../RHI/D3D11/D3D11_VertexBuffer.h"
 #include "../RHI/D3D11/D3D11_IndexBuffer.h"
@@ -59,7 +58,7 @@ namespace Directus
 		return true;
 	}
 
-	const Matrix& Grid::ComputeWorldMatrix(Transform* camera)
+	const Matrix& Grid::ComputeWorldMatrix(const Vector3& cameraPosition)
 	{
 		// To get the grid to feel infinite, it has to follow the camera,
 		// but only by increments of the grid's spacing size. This gives the illusion 
@@ -67,9 +66,9 @@ namespace Directus
 		float gridSpacing = 1.0f;
 		Vector3 translation = Vector3
 		(
-			(int)(camera->GetPosition().x / gridSpacing) * gridSpacing, 
+			(int)(cameraPosition.x / gridSpacing) * gridSpacing, 
 			0.0f, 
-			(int)(camera->GetPosition().z / gridSpacing) * gridSpacing
+			(int)(cameraPosition.z / gridSpacing) * gridSpacing
 		);
 	
 		m_world = Matrix::CreateScale(gridSpacing) * Matrix::CreateTranslation(translation);
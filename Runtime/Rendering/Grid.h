@@ -32,7 +32,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 namespace Directus
 {
 	class Context;
-	class Transform;
 
 	class ENGINE_CLASS Grid
 	{
@@ -41,7 +40,7 @@ namespace Directus
 		~Grid(){}
 		
 		bool SetBuffer();
-		const Math::Matrix& ComputeWorldMatrix(Transform* camera);
+		const Math::Matrix& ComputeWorldMatrix(const Math::Vector3& cameraPosition);
 		unsigned int GetIndexCount() { return m_indexCount; }
 
 	private:
@@ -102,11 +102,11 @@ namespace Directus
 			string texPath		= xml->GetAttributeAs<string>(nodeName, "Texture_Path");
 
 			// If the texture happens to be loaded, get a reference to it
-			m_textures[texType] = m_context->GetSubsystem<ResourceManager>()->GetResourceByName<RHI_Texture>(texName);
+			m_textures[texType] = m_context->GetSubsystem<ResourceManager>()->GetResourceByName<RHI_Texture>(texName).lock();
 			// If there is not texture (it's not loaded yet), load it
-			if (m_textures[texType].expired())
+			if (!m_textures[texType])
 			{
-				m_textures[texType] = m_context->GetSubsystem<ResourceManager>()->Load<RHI_Texture>(texPath);
+				m_textures[texType] = m_context->GetSubsystem<ResourceManager>()->Load<RHI_Texture>(texPath).lock();
 			}
 		}
 
@@ -152,24 +152,24 @@ namespace Directus
 			string texNode = "Texture_" + to_string(i);
 			xml->AddChildNode("Textures", texNode);
 			xml->AddAttribute(texNode, "Texture_Type", (unsigned int)texture.first);
-			xml->AddAttribute(texNode, "Texture_Name", !texture.second.expired() ? texture.second.lock()->GetResourceName() : NOT_ASSIGNED);
-			xml->AddAttribute(texNode, "Texture_Path", !texture.second.expired() ? texture.second.lock()->GetResourceFilePath() : NOT_ASSIGNED);
+			xml->AddAttribute(texNode, "Texture_Name", texture.second ? texture.second->GetResourceName() : NOT_ASSIGNED);
+			xml->AddAttribute(texNode, "Texture_Path", texture.second ? texture.second->GetResourceFilePath() : NOT_ASSIGNED);
 			i++;
 		}
 
 		return xml->Save(GetResourceFilePath());
 	}
 
-	unsigned int Material::GetMemory()
+	unsigned long long Material::GetMemory()
 	{
 		// Doesn't have to be spot on, just representative
-		unsigned int size = 0;
+		unsigned long long size = 0;
 		size += sizeof(bool) * 2;
 		size += sizeof(int) * 3;
 		size += sizeof(float) * 5;
 		size += sizeof(Vector2) * 2;
 		size += sizeof(Vector4);
-		size += (unsigned int)(sizeof(std::map<TextureType, std::weak_ptr<RHI_Texture>>) + (sizeof(TextureType) + sizeof(std::weak_ptr<RHI_Texture>)) * m_textures.size());
+		size += sizeof(std::map<TextureType, std::shared_ptr<RHI_Texture>>) + (sizeof(TextureType) + sizeof(std::shared_ptr<RHI_Texture>)) * m_textures.size();
 
 		return size;
 	}
@@ -191,7 +191,7 @@ namespace Directus
 		// Cache it or use the provided reference as is
 		auto texRef = autoCache ? textureWeak.lock()->Cache<RHI_Texture>() : textureWeak;
 		// Save a reference
-		m_textures[texture->GetType()] = texRef;
+		m_textures[texture->GetType()] = texRef.lock();
 
 		TextureBasedMultiplierAdjustment();
 		AcquireShader();
@@ -199,17 +199,17 @@ namespace Directus
 
 	bool Material::HasTextureOfType(TextureType type)
 	{
-		return !m_textures[type].expired();
+		return m_textures[type] != nullptr;
 	}
 
 	bool Material::HasTexture(const string& path)
 	{
 		for (const auto& it : m_textures)
 		{
-			if (it.second.expired())
+			if (!it.second)
 				continue;
 
-			if (it.second.lock()->GetResourceFilePath() == path)
+			if (it.second->GetResourceFilePath() == path)
 				return true;
 		}
 
@@ -218,10 +218,10 @@ namespace Directus
 
 	std::string Material::GetTexturePathByType(TextureType type)
 	{
-		if (m_textures[type].expired())
+		if (!m_textures[type])
 			return NOT_ASSIGNED;
 
-		return m_textures[type].lock()->GetResourceFilePath();
+		return m_textures[type]->GetResourceFilePath();
 	}
 
 	vector<string> Material::GetTexturePaths()
@@ -229,10 +229,10 @@ namespace Directus
 		vector<string> paths;
 		for (const auto& it : m_textures)
 		{
-			if (it.second.expired())
+			if (!it.second)
 				continue;
 
-			paths.push_back(it.second.lock()->GetResourceFilePath());
+			paths.push_back(it.second->GetResourceFilePath());
 		}
 
 		return paths;
@@ -298,24 +298,28 @@ namespace Directus
 		return shader->Cache<ShaderVariation>();
 	}
 
-	const std::vector<void*>& Material::GetShaderResources()
+	void Material::GetShaderResources(void** shaderResources)
 	{
-		m_shaderResources.clear();
-		m_shaderResources.shrink_to_fit();
-
 		// Must maintain the same order as the way the G-Buffer stage expects them to
-		// Note: this is not efficient, have to do it better
-		#define GET_SR(type) !m_textures[type].expired() ? m_textures[type].lock()->GetShaderResource() : nullptr
-		m_shaderResources.emplace_back(GET_SR(TextureType_Albedo));
-		m_shaderResources.emplace_back(GET_SR(TextureType_Roughness));
-		m_shaderResources.emplace_back(GET_SR(TextureType_Metallic));
-		m_shaderResources.emplace_back(GET_SR(TextureType_Normal));
-		m_shaderResources.emplace_back(GET_SR(TextureType_Height));
-		m_shaderResources.emplace_back(GET_SR(TextureType_Occlusion));
-		m_shaderResources.emplace_back(GET_SR(TextureType_Emission));
-		m_shaderResources.emplace_back(GET_SR(TextureType_Mask));
-
-		return m_shaderResources;
+		static const TextureType types[MATERIAL_SHADER_RESOURCES] =
+		{
+			TextureType_Albedo,
+			TextureType_Roughness,
+			TextureType_Metallic,
+			TextureType_Normal,
+			TextureType_Height,
+			TextureType_Occlusion,
+			TextureType_Emission,
+			TextureType_Mask
+		};
+
+		// Only looks up (operator[] would insert), as chunks of the G-Buffer pass are recorded in parallel
+		for (unsigned int i = 0; i < MATERIAL_SHADER_RESOURCES; i++)
+		{
+			auto it				= m_textures.find(types[i]);
+			auto texture		= it != m_textures.end() ? it->second.get() : nullptr;
+			shaderResources[i]	= texture ? texture->GetShaderResource() : nullptr;
+		}
 	}
 
 	void Material::SetMultiplier(TextureType type, float value)
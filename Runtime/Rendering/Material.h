@@ -36,6 +36,9 @@ namespace Directus
 	class ShaderVariation;
 	class TexturePool;
 
+	// Textures bound per material (t0 - t7 in GBuffer.hlsl)
+	static const unsigned int MATERIAL_SHADER_RESOURCES = 8;
+
 	class ENGINE_CLASS Material : public IResource
 	{
 	public:
@@ -52,12 +55,13 @@ namespace Directus
 		//= IResource ==================================================
 		bool LoadFromFile(const std::string& filePath) override;
 		bool SaveToFile(const std::string& filePath) override;
-		unsigned int GetMemory() override;
+		unsigned long long GetMemory() override;
 		//==============================================================
 
 		//= TEXTURES =====================================================================
 		void SetTexture(const std::weak_ptr<RHI_Texture>& textureWeak, bool autoCache = true);
 		std::weak_ptr<RHI_Texture> GetTextureByType(TextureType type) { return m_textures[type]; }
+		const std::map<TextureType, std::shared_ptr<RHI_Texture>>& GetTextures() { return m_textures; }
 		bool HasTextureOfType(TextureType type);
 		bool HasTexture(const std::string& path);
 		std::string GetTexturePathByType(TextureType type);
@@ -70,7 +74,8 @@ namespace Directus
 		std::weak_ptr<ShaderVariation> GetOrCreateShader(unsigned long shaderFlags);
 		std::weak_ptr<ShaderVariation> GetShader() { return m_shader; }
 		bool HasShader() { return GetShader().expired() ? false : true; }
-		const std::vector<void*>& GetShaderResources();
+		// Fills MATERIAL_SHADER_RESOURCES texture pointers, safe to call from multiple threads
+		void GetShaderResources(void** shaderResources);
 		//====================================================================================
 
 		//= PROPERTIES ================================================================	
@@ -137,8 +142,7 @@ namespace Directus
 		Math::Vector2 m_uvOffset;	
 		bool m_isEditable;
 		std::weak_ptr<ShaderVariation> m_shader;
-		// <tex_type, <tex,	tex_path>>
-		std::map<TextureType, std::weak_ptr<RHI_Texture>> m_textures;
-		std::vector<void*> m_shaderResources;
+		// <tex_type, tex>, held so that the resource cache doesn't evict textures which are in use
+		std::map<TextureType, std::shared_ptr<RHI_Texture>> m_textures;
 	};
 }
\ No newline at end of file
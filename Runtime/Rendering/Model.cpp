@@ -27,6 +27,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../RHI/RHI_Implementation.h"
 #include "../RHI/D3D11/D3D11_VertexBuffer.h"
 #include "../RHI/D3D11/D3D11_IndexBuffer.h"
+#include "../RHI/RHI_CommandList.h"
+#include "../Scene/Scene.h"
 #include "../Scene/Actor.h"
 #include "../Scene/Components/Transform.h"
 #include "../Scene/Components/Renderable.h"
@@ -34,6 +36,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/Stopwatch.h"
 #include "../Resource/ResourceManager.h"
 #include "../Math/BoundingBox.h"
+#include "../Threading/Threading.h"
 //=========================================
 
 //= NAMESPACES ================
@@ -154,12 +157,23 @@ namespace Directus
 		return success;
 	}
 
+	bool Model::Geometry_Bind(RHI_CommandList* commandList)
+	{
+		if (!m_indexBuffer || !m_vertexBuffer)
+			return false;
+
+		commandList->Bind_IndexBuffer(m_indexBuffer.get());
+		commandList->Bind_VertexBuffer(m_vertexBuffer.get());
+
+		return true;
+	}
+
 	void Model::Geometry_Update()
 	{
 		Geometry_CreateBuffers();
 		m_normalizedScale	= Geometry_ComputeNormalizedScale();
 		m_memoryUsage		= Geometry_ComputeMemoryUsage();
-		m_aabb				= BoundingBox(m_mesh->Vertices_Get());
+		m_aabb				= Geometry_ComputeAABB();
 	}
 
 	void Model::AddMaterial(const weak_ptr<Material>& material, const weak_ptr<Actor>& actor, bool autoCache /* true */)
@@ -269,10 +283,12 @@ namespace Directus
 		if (!file->IsOpen())
 			return false;
 
-		int meshCount = 0;
-
-		file->Read(&m_resourceName);
-		file->Read(&m_resourceFilePath);
+		// Through the setters, the model might already be cached under a different name
+		string name, path;
+		file->Read(&name);
+		file->Read(&path);
+		SetResourceName(name);
+		SetResourceFilePath(path);
 		file->Read(&m_normalizedScale);
 		file->Read(&m_mesh->Indices_Get());
 		file->Read(&m_mesh->Vertices_Get());
@@ -289,7 +305,8 @@ namespace Directus
 		SetResourceFilePath(m_modelDirectoryModel + FileSystem::GetFileNameNoExtensionFromFilePath(filePath) + EXTENSION_MODEL); // Assets/Sponza/Sponza.model
 		SetResourceName(FileSystem::GetFileNameNoExtensionFromFilePath(filePath)); // Sponza
 
-		// Load the model
+		// Load the model (it gets added to the scene, which is left alone by the frame meanwhile)
+		auto loading = m_context->GetSubsystem<Scene>()->Loading_Lock();
 		if (m_resourceManager->GetModelImporter().lock()->Load(this, filePath))
 		{
 			// Set the normalized scale to the root actor's transform
@@ -367,4 +384,15 @@ namespace Directus
 
 		return size;
 	}
-}
+
+	BoundingBox Model::Geometry_ComputeAABB()
+	{
+		const auto& vertices = m_mesh->Vertices_Get();
+
+		// Compute a bounding box per chunk of vertices in parallel and merge them
+		return m_context->GetSubsystem<Threading>()->ParallelReduce(0, (unsigned int)vertices.size(), 0, BoundingBox(),
+			[&vertices](unsigned int begin, unsigned int end) { return BoundingBox(&vertices[begin], end - begin); },
+			[](BoundingBox a, const BoundingBox& b) { a.Merge(b); return a; }
+		);
+	}
+}
\ No newline at end of file
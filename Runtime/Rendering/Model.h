@@ -51,7 +51,7 @@ namespace Directus
 		//= RESOURCE INTERFACE ====================================
 		bool LoadFromFile(const std::string& filePath) override;
 		bool SaveToFile(const std::string& filePath) override;
-		unsigned int GetMemory() override { return m_memoryUsage; }
+		unsigned long long GetMemory() override { return m_memoryUsage; }
 		//=========================================================
 
 		// Sets the actor that represents this model in the scene
@@ -73,6 +73,8 @@ namespace Directus
 			std::vector<RHI_Vertex_PosUVTBN>* vertices
 		);
 		bool Geometry_Bind();
+		// Records the binds instead, without logging (might be called from any thread)
+		bool Geometry_Bind(RHI_CommandList* commandList);
 		void Geometry_Update();
 		const Math::BoundingBox& Geometry_AABB() { return m_aabb; }
 		//=========================================================
@@ -100,6 +102,7 @@ namespace Directus
 		bool Geometry_CreateBuffers();
 		float Geometry_ComputeNormalizedScale();
 		unsigned int Geometry_ComputeMemoryUsage();
+		Math::BoundingBox Geometry_ComputeAABB();
 
 		// The root actor that represents this model in the scene
 		std::weak_ptr<Actor> m_rootactor;
@@ -0,0 +1,347 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES =================================
+#include "RenderGraph.h"
+#include "../RHI/D3D11/D3D11_RenderTexture.h"
+#include "../Logging/Log.h"
+#include "../Profiling/Profiler.h"
+//============================================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+namespace Directus
+{
+	// Pooled textures that go unused for this many frames are released (e.g. after an effect gets disabled)
+	static const unsigned int g_framesBeforeRelease = 60;
+	static const RenderGraph_Resource g_resourceNone = ~0u;
+
+	unsigned long long RenderGraph_TextureDesc::GetMemoryUsage() const
+	{
+		static const unsigned int bytesPerPixel[] =
+		{
+			1,	// Texture_Format_R8_UNORM
+			4,	// Texture_Format_R8G8B8A8_UNORM
+			2,	// Texture_Format_R16_FLOAT
+			4,	// Texture_Format_R32_FLOAT
+			8,	// Texture_Format_R32G32_FLOAT
+			12,	// Texture_Format_R32G32B32_FLOAT
+			8,	// Texture_Format_R16G16B16A16_FLOAT
+			16	// Texture_Format_R32G32B32A32_FLOAT
+		};
+
+		return (unsigned long long)width * height * bytesPerPixel[format];
+	}
+
+	RenderGraph::RenderGraph(RHI* rhi)
+	{
+		m_rhi = rhi;
+	}
+
+	RenderGraph::~RenderGraph()
+	{
+		Reset();
+		m_pool.clear();
+	}
+
+	void RenderGraph::Reset()
+	{
+		m_resources.clear();
+		m_passes.clear();
+	}
+
+	RenderGraph_Resource RenderGraph::Texture_Create(const char* name, const RenderGraph_TextureDesc& desc)
+	{
+		Resource resource;
+		resource.name			= name;
+		resource.desc			= desc;
+		resource.imported		= false;
+		resource.extractTarget	= nullptr;
+		resource.forward		= g_resourceNone;
+		resource.pool			= -1;
+		resource.lastUse		= -1;
+		m_resources.emplace_back(resource);
+
+		return RenderGraph_Resource(m_resources.size() - 1);
+	}
+
+	RenderGraph_Resource RenderGraph::Texture_Import(const char* name, shared_ptr<D3D11_RenderTexture> texture)
+	{
+		auto resource = Texture_Create(name, RenderGraph_TextureDesc());
+		m_resources[resource].imported	= true;
+		m_resources[resource].texture	= move(texture);
+
+		return resource;
+	}
+
+	void RenderGraph::Texture_Extract(RenderGraph_Resource resource, shared_ptr<D3D11_RenderTexture>* target)
+	{
+		if (!IsValid(resource) || !target)
+		{
+			LOG_ERROR("RenderGraph::Texture_Extract: Invalid parameters");
+			return;
+		}
+
+		m_resources[resource].extractTarget = target;
+	}
+
+	D3D11_RenderTexture* RenderGraph::Texture_Get(RenderGraph_Resource resource)
+	{
+		if (!IsValid(resource))
+			return nullptr;
+
+		const Resource& physical = m_resources[Resolve(resource)];
+		if (physical.imported)
+			return physical.texture.get();
+
+		return physical.pool != -1 ? m_pool[physical.pool].texture.get() : nullptr;
+	}
+
+	void RenderGraph::Pass_Add(const char* name, bool enabled, const vector<RenderGraph_Resource>& reads, const vector<RenderGraph_Resource>& writes, function<void()>&& execute)
+	{
+		for (const auto& resource : reads)
+		{
+			if (!IsValid(resource))
+			{
+				LOGF_ERROR("RenderGraph::Pass_Add: Pass \"%s\" reads an invalid resource", name);
+				return;
+			}
+		}
+
+		for (const auto& resource : writes)
+		{
+			if (!IsValid(resource))
+			{
+				LOGF_ERROR("RenderGraph::Pass_Add: Pass \"%s\" writes an invalid resource", name);
+				return;
+			}
+		}
+
+		Pass pass;
+		pass.name		= name;
+		pass.enabled	= enabled;
+		pass.live		= false;
+		pass.reads		= reads;
+		pass.writes		= writes;
+		pass.execute	= move(execute);
+		m_passes.emplace_back(move(pass));
+	}
+
+	void RenderGraph::Execute()
+	{
+		PROFILE_FUNCTION_BEGIN();
+		Cull();
+
+		// Walk the live passes in order. Outputs get a pooled texture on their first use, and once a
+		// transient texture is used for the last time its pool entry is free for the textures that follow.
+		for (int i = 0; i < (int)m_passes.size(); i++)
+		{
+			Pass& pass = m_passes[i];
+			if (!pass.live)
+				continue;
+
+			auto acquire = [this](RenderGraph_Resource resource)
+			{
+				Resource& physical = m_resources[Resolve(resource)];
+				if (!physical.imported && physical.pool == -1)
+				{
+					physical.pool = Pool_Acquire(physical.desc);
+				}
+			};
+			for (const auto& resource : pass.writes)	acquire(resource);
+			for (const auto& resource : pass.reads)		acquire(resource); // Reading something nobody wrote, contents are undefined
+
+			pass.execute();
+
+			auto release = [this, i](RenderGraph_Resource resource)
+			{
+				Resource& physical = m_resources[Resolve(resource)];
+				if (physical.lastUse != i || physical.extractTarget)
+					return;
+
+				if (physical.pool != -1)
+				{
+					m_pool[physical.pool].assigned = false;
+				}
+				else if (physical.imported)
+				{
+					physical.texture.reset();
+				}
+			};
+			for (const auto& resource : pass.writes)	release(resource);
+			for (const auto& resource : pass.reads)		release(resource);
+		}
+
+		// Hand over extracted textures, whatever the targets held before goes back to the pool
+		for (auto& resource : m_resources)
+		{
+			if (!resource.extractTarget)
+				continue;
+
+			const Resource& physical = m_resources[Resolve(RenderGraph_Resource(&resource - &m_resources[0]))];
+			if (physical.imported)
+			{
+				*resource.extractTarget = physical.texture;
+			}
+			else if (physical.pool != -1)
+			{
+				*resource.extractTarget = m_pool[physical.pool].texture;
+			}
+		}
+
+		// Release what hasn't been used for a while
+		unsigned long long memory = 0;
+		for (auto it = m_pool.begin(); it != m_pool.end();)
+		{
+			bool heldOutside = it->texture.use_count() > 1;
+			it->framesUnused = (it->assigned || heldOutside) ? 0 : it->framesUnused + 1;
+			it->assigned = false;
+
+			if (it->framesUnused > g_framesBeforeRelease)
+			{
+				it = m_pool.erase(it);
+				continue;
+			}
+
+			memory += it->desc.GetMemoryUsage();
+			++it;
+		}
+
+		Profiler::Get().m_renderTargets		= (unsigned int)m_pool.size();
+		Profiler::Get().m_renderTargetMemory	= memory;
+		PROFILE_FUNCTION_END();
+	}
+
+	void RenderGraph::Pool_Clear()
+	{
+		for (auto it = m_pool.begin(); it != m_pool.end();)
+		{
+			it = (it->texture.use_count() > 1) ? it + 1 : m_pool.erase(it);
+		}
+	}
+
+	unsigned long long RenderGraph::Pool_GetMemoryUsage()
+	{
+		unsigned long long memory = 0;
+		for (const auto& entry : m_pool)
+		{
+			memory += entry.desc.GetMemoryUsage();
+		}
+
+		return memory;
+	}
+
+	RenderGraph_Resource RenderGraph::Resolve(RenderGraph_Resource resource)
+	{
+		while (m_resources[resource].forward != g_resourceNone)
+		{
+			resource = m_resources[resource].forward;
+		}
+
+		return resource;
+	}
+
+	void RenderGraph::Cull()
+	{
+		// Disabled passes forward their first output to their first input
+		for (auto& pass : m_passes)
+		{
+			if (pass.enabled || pass.writes.empty() || pass.reads.empty())
+				continue;
+
+			RenderGraph_Resource input = Resolve(pass.reads.front());
+			RenderGraph_Resource output = pass.writes.front();
+			if (Resolve(output) != input)
+			{
+				m_resources[output].forward = input;
+			}
+		}
+
+		// Walk backwards from what has to exist after the frame (imported and extracted textures),
+		// a pass is live if something that's needed later on is written by it.
+		vector<bool> needed(m_resources.size(), false);
+		for (unsigned int i = 0; i < m_resources.size(); i++)
+		{
+			const Resource& resource = m_resources[i];
+			if (resource.imported || resource.extractTarget)
+			{
+				needed[Resolve(i)] = true;
+			}
+		}
+
+		for (auto it = m_passes.rbegin(); it != m_passes.rend(); ++it)
+		{
+			Pass& pass = *it;
+			pass.live = false;
+			if (!pass.enabled)
+				continue;
+
+			for (const auto& resource : pass.writes)
+			{
+				pass.live = pass.live || needed[Resolve(resource)];
+			}
+
+			if (!pass.live)
+				continue;
+
+			for (const auto& resource : pass.reads)
+			{
+				needed[Resolve(resource)] = true;
+			}
+		}
+
+		// Lifetimes
+		for (int i = 0; i < (int)m_passes.size(); i++)
+		{
+			const Pass& pass = m_passes[i];
+			if (!pass.live)
+				continue;
+
+			for (const auto& resource : pass.reads)		m_resources[Resolve(resource)].lastUse = i;
+			for (const auto& resource : pass.writes)	m_resources[Resolve(resource)].lastUse = i;
+		}
+	}
+
+	int RenderGraph::Pool_Acquire(const RenderGraph_TextureDesc& desc)
+	{
+		// A texture that someone else still holds (e.g. the previous frame) can't be handed out
+		for (unsigned int i = 0; i < m_pool.size(); i++)
+		{
+			PoolEntry& entry = m_pool[i];
+			if (!entry.assigned && entry.desc == desc && entry.texture.use_count() == 1)
+			{
+				entry.assigned = true;
+				return (int)i;
+			}
+		}
+
+		PoolEntry entry;
+		entry.desc			= desc;
+		entry.texture		= make_shared<D3D11_RenderTexture>(m_rhi, desc.width, desc.height, false, desc.format);
+		entry.assigned		= true;
+		entry.framesUnused	= 0;
+		m_pool.emplace_back(entry);
+
+		return (int)m_pool.size() - 1;
+	}
+}
\ No newline at end of file
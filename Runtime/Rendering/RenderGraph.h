@@ -0,0 +1,148 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==================
+#include <memory>
+#include <vector>
+#include <functional>
+#include "../Core/EngineDefs.h"
+#include "../RHI/RHI_Definition.h"
+//=============================
+
+namespace Directus
+{
+	// Describes a transient texture, textures with equal descriptions are interchangeable
+	struct RenderGraph_TextureDesc
+	{
+		RenderGraph_TextureDesc() {}
+		RenderGraph_TextureDesc(int width, int height, Texture_Format format)
+		{
+			this->width		= width;
+			this->height	= height;
+			this->format	= format;
+		}
+
+		bool operator==(const RenderGraph_TextureDesc& rhs) const
+		{
+			return width == rhs.width && height == rhs.height && format == rhs.format;
+		}
+
+		unsigned long long GetMemoryUsage() const;
+
+		int width				= 0;
+		int height				= 0;
+		Texture_Format format	= Texture_Format_R8G8B8A8_UNORM;
+	};
+
+	// A handle to a texture declared to the graph, only meaningful for the frame it was declared in
+	typedef unsigned int RenderGraph_Resource;
+
+	// Passes declare the textures they read and write and the graph works out the rest:
+	// - Disabled passes are culled, as well as passes whose outputs nobody reads.
+	// - Transient textures come from a pool, keyed by their description.
+	// - A transient texture is only held from the first pass that uses it until the last one,
+	//   after that the same memory can be handed to another texture (aliasing).
+	// Usage: Reset(), declare textures and passes, Execute(). Passes run in the order they were declared.
+	class ENGINE_CLASS RenderGraph
+	{
+	public:
+		RenderGraph(RHI* rhi);
+		~RenderGraph();
+
+		// Forgets the passes and textures of the previous frame, pooled textures are kept
+		void Reset();
+
+		//= TEXTURES ===========================================================================================
+		// A texture that only lives while the frame executes, its content is undefined until a pass writes it
+		RenderGraph_Resource Texture_Create(const char* name, const RenderGraph_TextureDesc& desc);
+		// A texture that is owned outside of the graph (can be null). When the only reference is moved in,
+		// a texture that came from the pool goes back to it after the last pass that uses it.
+		RenderGraph_Resource Texture_Import(const char* name, std::shared_ptr<D3D11_RenderTexture> texture);
+		// Hands the texture over once Execute() is done, so it outlives the frame
+		void Texture_Extract(RenderGraph_Resource resource, std::shared_ptr<D3D11_RenderTexture>* target);
+		// Only valid while passes execute
+		D3D11_RenderTexture* Texture_Get(RenderGraph_Resource resource);
+		//======================================================================================================
+
+		// Declares a pass. A pass that draws on top of a texture has to both read and write it.
+		// When a pass is disabled, its first output forwards to its first input, so passes chained after it keep working.
+		void Pass_Add(
+			const char* name,
+			bool enabled,
+			const std::vector<RenderGraph_Resource>& reads,
+			const std::vector<RenderGraph_Resource>& writes,
+			std::function<void()>&& execute
+		);
+
+		// Culls passes, assigns pooled textures and executes what's left
+		void Execute();
+
+		//= POOL ==============================================================================================
+		// Releases every pooled texture that isn't held outside of the graph (e.g. on a resolution change)
+		void Pool_Clear();
+		unsigned int Pool_GetCount()					{ return (unsigned int)m_pool.size(); }
+		unsigned long long Pool_GetMemoryUsage();
+		//======================================================================================================
+
+	private:
+		struct Resource
+		{
+			const char* name;
+			RenderGraph_TextureDesc desc;
+			bool imported;
+			std::shared_ptr<D3D11_RenderTexture> texture;	// When imported
+			std::shared_ptr<D3D11_RenderTexture>* extractTarget;
+			RenderGraph_Resource forward;	// What a culled pass forwarded this resource to
+			int pool;						// Assigned pool entry, -1 if none
+			int lastUse;					// Index of the last live pass that uses this resource
+		};
+
+		struct Pass
+		{
+			const char* name;
+			bool enabled;
+			bool live;
+			std::vector<RenderGraph_Resource> reads;
+			std::vector<RenderGraph_Resource> writes;
+			std::function<void()> execute;
+		};
+
+		struct PoolEntry
+		{
+			RenderGraph_TextureDesc desc;
+			std::shared_ptr<D3D11_RenderTexture> texture;
+			bool assigned;				// To a resource of the frame being executed
+			unsigned int framesUnused;
+		};
+
+		RenderGraph_Resource Resolve(RenderGraph_Resource resource);
+		bool IsValid(RenderGraph_Resource resource) { return resource < (RenderGraph_Resource)m_resources.size(); }
+		void Cull();
+		int Pool_Acquire(const RenderGraph_TextureDesc& desc);
+
+		std::vector<Resource> m_resources;
+		std::vector<Pass> m_passes;
+		std::vector<PoolEntry> m_pool;
+		RHI* m_rhi;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ===============
+#include "RenderQueue.h"
+#include "../Math/MathHelper.h"
+//==========================
+
+//= NAMESPACES ================
+using namespace std;
+using namespace Directus::Math;
+//=============================
+
+namespace Directus
+{
+	void RenderQueue::Sort()
+	{
+		unsigned int count = (unsigned int)m_entries.size();
+		if (count <= 1)
+			return;
+
+		// Least significant digit first, 8 bits at a time
+		unsigned int histograms[8][256] = {};
+		for (const auto& entry : m_entries)
+		{
+			for (unsigned int digit = 0; digit < 8; digit++)
+			{
+				histograms[digit][(entry.key >> (digit * 8)) & 0xFF]++;
+			}
+		}
+
+		m_scratch.resize(count);
+		vector<RenderQueueEntry>* source		= &m_entries;
+		vector<RenderQueueEntry>* destination	= &m_scratch;
+		for (unsigned int digit = 0; digit < 8; digit++)
+		{
+			unsigned int* histogram	= histograms[digit];
+			unsigned int shift		= digit * 8;
+
+			// All the keys share this digit (e.g. the pass), nothing to do
+			if (histogram[((*source)[0].key >> shift) & 0xFF] == count)
+				continue;
+
+			unsigned int offsets[256];
+			unsigned int offset = 0;
+			for (unsigned int bucket = 0; bucket < 256; bucket++)
+			{
+				offsets[bucket]	= offset;
+				offset			+= histogram[bucket];
+			}
+
+			for (const auto& entry : *source)
+			{
+				(*destination)[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+			}
+			swap(source, destination);
+		}
+
+		if (source != &m_entries)
+		{
+			m_entries.swap(m_scratch);
+		}
+	}
+
+	unsigned long long RenderQueue::ComputeKey(RenderPass pass, unsigned int shader, unsigned int material, unsigned int geometry, float depth)
+	{
+		unsigned long long depthBucket = (unsigned long long)(Clamp(depth, 0.0f, 1.0f) * 65535.0f);
+
+		return
+			((unsigned long long)(pass		& 0xF)		<< 60)	|
+			((unsigned long long)(shader	& 0xFFF)	<< 48)	|
+			((unsigned long long)(material	& 0xFFFF)	<< 32)	|
+			((unsigned long long)(geometry	& 0xFFFF)	<< 16)	|
+			depthBucket;
+	}
+}
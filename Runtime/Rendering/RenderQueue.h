@@ -0,0 +1,66 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==================
+#include <vector>
+#include "../Core/EngineDefs.h"
+//=============================
+
+namespace Directus
+{
+	enum RenderPass : unsigned int
+	{
+		RenderPass_Shadow,
+		RenderPass_Opaque,
+		RenderPass_Debug
+	};
+
+	struct RenderQueueEntry
+	{
+		unsigned long long key;
+		unsigned int drawIndex; // Into the snapshot's items
+	};
+
+	// A flat list of draws, sorted by a 64-bit key with a radix sort.
+	// The key, from the most significant bits to the least:
+	// | pass (4) | shader (12) | material (16) | geometry (16) | depth (16) |
+	class ENGINE_CLASS RenderQueue
+	{
+	public:
+		RenderQueue() {}
+		~RenderQueue() {}
+
+		void Clear() { m_entries.clear(); }
+		void Add(unsigned long long key, unsigned int drawIndex) { m_entries.push_back({ key, drawIndex }); }
+		void Sort();
+		const std::vector<RenderQueueEntry>& GetEntries() const { return m_entries; }
+		bool IsEmpty() const { return m_entries.empty(); }
+
+		// Shader, material and geometry are compact (per snapshot) IDs, depth is a bucket in [0, 1] of the view distance
+		static unsigned long long ComputeKey(RenderPass pass, unsigned int shader, unsigned int material, unsigned int geometry, float depth);
+
+	private:
+		std::vector<RenderQueueEntry> m_entries;
+		std::vector<RenderQueueEntry> m_scratch;
+	};
+}
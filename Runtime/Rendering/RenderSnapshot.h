@@ -0,0 +1,126 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES =============================
+#include <vector>
+#include <memory>
+#include "../RHI/RHI_Definition.h"
+#include "../RHI/RHI_Vertex.h"
+#include "../Math/Matrix.h"
+#include "../Math/Vector4.h"
+#include "../Math/BoundingBox.h"
+#include "../Math/Frustum.h"
+#include "../Scene/Components/Light.h"
+#include "RenderQueue.h"
+//========================================
+
+namespace Directus
+{
+	class Model;
+	class Material;
+	class ShaderVariation;
+
+	// A renderable, as it was when the snapshot was captured
+	struct RenderItem
+	{
+		Math::Matrix world;
+		Math::BoundingBox aabb; // world space
+		// Held, so that they outlive the snapshot even if the scene lets go of them meanwhile
+		std::shared_ptr<Model> model;
+		std::shared_ptr<Material> material;
+		std::shared_ptr<ShaderVariation> shader;
+		unsigned int indexCount		= 0;
+		unsigned int indexOffset	= 0;
+		unsigned int vertexOffset	= 0;
+		bool visible				= false;	// To the camera, otherwise it's only a shadow caster
+		bool castShadows			= false;
+
+		// What the render queue keys are made of
+		unsigned int idShader		= 0;	// Compact (per snapshot) IDs
+		unsigned int idMaterial		= 0;
+		unsigned int idMesh			= 0;	// Model and index range, so that identical meshes end up next to each other
+		float depth					= 0.0f;	// View distance, normalized
+	};
+
+	// A light, as it was when the snapshot was captured
+	struct RenderLight
+	{
+		LightType type			= LightType_Point;
+		Math::Vector4 color;
+		Math::Vector3 position;
+		Math::Vector3 direction;
+		float intensity			= 0.0f;
+		float range				= 0.0f;
+		float angle				= 0.0f;
+		bool castShadows		= false;
+		Math::Matrix view;
+		std::vector<Math::Matrix> projections;	// One per shadow map
+		std::vector<RenderQueue> casters;		// One per shadow map, the (culled) items that cast shadows into it
+		Math::Vector4 splits;					// Cascade splits (directional light only)
+		float shadowMapResolution = 0.0f;
+		std::vector<std::shared_ptr<D3D11_RenderTexture>> shadowMaps; // Kept alive, even if the light goes away
+	};
+
+	// The camera, as it was when the snapshot was captured
+	struct RenderCamera
+	{
+		Math::Matrix view;
+		Math::Matrix baseView;
+		Math::Matrix projection;
+		Math::Vector3 position;
+		Math::Vector4 clearColor;
+		Math::Frustum frustum;
+		float nearPlane	= 0.0f;
+		float farPlane	= 0.0f;
+	};
+
+	// Everything the renderer needs in order to draw a frame. It's captured once the simulation is done
+	// and it's never touched by it again, so it can be rendered while the next frame is being simulated.
+	struct RenderSnapshot
+	{
+		void Clear()
+		{
+			// Keep the capacity, snapshots are re-captured every frame
+			items.clear();
+			queueOpaque.Clear();
+			queueDebug.Clear();
+			lights.clear();
+			lines.clear();
+			directionalLight	= -1;
+			hasCamera			= false;
+			environment.reset();
+		}
+
+		const RenderLight* GetDirectionalLight() const { return directionalLight != -1 ? &lights[directionalLight] : nullptr; }
+
+		std::vector<RenderItem> items;
+		RenderQueue queueOpaque;
+		RenderQueue queueDebug;
+		std::vector<RenderLight> lights;
+		std::vector<RHI_Vertex_PosCol> lines;		// Debug lines (physics, picking ray)
+		std::shared_ptr<RHI_Texture> environment;	// Skybox cubemap
+		RenderCamera camera;
+		int directionalLight	= -1;
+		bool hasCamera			= false;
+	};
+}
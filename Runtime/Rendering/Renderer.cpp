@@ -26,12 +26,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Mesh.h"
 #include "Grid.h"
 #include "Font.h"
+#include "RenderGraph.h"
+#include "TextureStreamer.h"
 #include "Deferred/ShaderVariation.h"
 #include "Deferred/LightShader.h"
 #include "Deferred/GBuffer.h"
 #include "../RHI/RHI_Shader.h"
 #include "../RHI/RHI_Texture.h"
-#include "../RHI/D3D11/D3D11_Device.h"
+#include "../RHI/RHI_Implementation.h"
 #include "../RHI/D3D11/D3D11_RenderTexture.h"
 #include "../RHI/D3D11/D3D11_Sampler.h"
 #include "../RHI/D3D11/D3D11_Shader.h"
@@ -39,8 +41,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/Context.h"
 #include "../Core/EventSystem.h"
 #include "../Scene/Actor.h"
+#include "../Scene/ComponentPool.h"
+#include "../Scene/AABBTree.h"
 #include "../Scene/Components/Transform.h"
 #include "../Scene/Components/Renderable.h"
+#include "../Scene/Components/Camera.h"
+#include "../Scene/Components/Light.h"
 #include "../Scene/Components/Skybox.h"
 #include "../Scene/Components/LineRenderer.h"
 #include "../Physics/Physics.h"
@@ -48,6 +54,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Logging/Log.h"
 #include "../Resource/ResourceManager.h"
 #include "../Scene/TransformationGizmo.h"
+#include "../Threading/Threading.h"
 //============================================
 
 //= NAMESPACES ================
@@ -62,14 +69,31 @@ namespace Directus
 {
 	static Physics* g_physics				= nullptr;
 	static ResourceManager* g_resourceMng	= nullptr;
+	// Fewer draws than this aren't worth recording on another thread
+	static const unsigned int RECORD_MIN_GRAIN = 64;
 	unsigned long Renderer::m_flags;
 
+	// Same as Camera::WorldToScreenPoint(), but against the captured matrices
+	static Vector2 WorldToScreenPoint(const Vector3& worldPoint, const Matrix& viewProjection)
+	{
+		Vector2 viewport	= Settings::Get().GetResolution();
+		Vector3 localSpace	= worldPoint * viewProjection;
+
+		float screenX = localSpace.x	/ localSpace.z	* (viewport.x * 0.5f)	+ viewport.x * 0.5f;
+		float screenY = -(localSpace.y	/ localSpace.z	* (viewport.y * 0.5f))	+ viewport.y * 0.5f;
+
+		return Vector2(screenX, screenY);
+	}
+
 	Renderer::Renderer(Context* context) : Subsystem(context)
 	{
 		m_skybox					= nullptr;
 		m_camera					= nullptr;
 		m_texEnvironment			= nullptr;
-		m_lineRenderer				= nullptr;
+		m_snapshot					= nullptr;
+		m_snapshotCapture			= 0;
+		m_snapshotRender			= 1;
+		m_snapshotCaptured			= false;
 		m_nearPlane					= 0.0f;
 		m_farPlane					= 0.0f;
 		m_rhi						= nullptr;
@@ -81,15 +105,18 @@ namespace Directus
 		m_flags						|= Render_Sharpening;
 		m_flags						|= Render_ChromaticAberration;
 		m_flags						|= Render_Correction;
+		m_textureStreamer			= make_unique<TextureStreamer>();
+		m_textureStreamer->SetBudget(TEXTURE_STREAMING_BUDGET);
 
 		// Subscribe to events
-		SUBSCRIBE_TO_EVENT(EVENT_RENDER, EVENT_HANDLER(Render));
-		SUBSCRIBE_TO_EVENT(EVENT_SCENE_RESOLVED, EVENT_HANDLER_VARIANT(Renderables_Acquire));
+		SUBSCRIBE_TO_EVENT(EVENT_SCENE_RESOLVED, EVENT_HANDLER(Renderables_Acquire));
+		SUBSCRIBE_TO_EVENT(EVENT_SCENE_CLEARED, EVENT_HANDLER(Clear));
 	}
 
 	Renderer::~Renderer()
 	{
-
+		// The mip loads hold on to textures
+		m_context->GetSubsystem<Threading>()->Wait(m_texturesLoadTasks);
 	}
 
 	bool Renderer::Initialize()
@@ -114,8 +141,12 @@ namespace Directus
 		// Make a grid (used in editor)
 		m_grid = make_unique<Grid>(m_context);
 
+		m_renderGraph = make_unique<RenderGraph>(m_rhi);
 		RenderTargets_Create(Settings::Get().GetResolutionWidth(), Settings::Get().GetResolutionHeight());
 
+		// Per object data, it grows if a frame needs more
+		m_uploadRing = make_unique<RHI_UploadRing>(m_rhi, 4 * 1024 * 1024);
+
 		// SAMPLERS
 		{
 			m_samplerPointWrapAlways		= make_unique<D3D11_Sampler>(m_rhi, Texture_Sampler_Point,			Texture_Address_Wrap,	Texture_Comparison_Always);
@@ -243,6 +274,9 @@ namespace Directus
 			m_gizmoRectLight = make_unique<Rectangle>(m_context);
 		}
 
+		// Owned by the renderer (instead of an actor) as it's filled from the snapshot
+		m_lineRenderer = make_unique<LineRenderer>(m_context, nullptr, nullptr);
+
 		return true;
 	}
 
@@ -268,7 +302,7 @@ namespace Directus
 
 	void* Renderer::GetFrame()
 	{
-		return m_renderTexPong ? m_renderTexPong->GetShaderResourceView() : nullptr;
+		return m_frame ? m_frame->GetShaderResourceView() : nullptr;
 	}
 
 	void Renderer::Present()
@@ -283,49 +317,46 @@ namespace Directus
 
 		PROFILE_FUNCTION_BEGIN();
 		Profiler::Get().Reset();
+		m_uploadRing->NewFrame();
+
+		// Only the snapshot is read from here on, the scene might already be simulating the next frame
+		m_snapshot = &m_snapshots[m_snapshotRender];
 
 		// If there is a camera, render the scene
-		if (m_camera)
+		if (m_snapshot->hasCamera)
 		{
-			m_mV					= m_camera->GetViewMatrix();
-			m_mV_base				= m_camera->GetBaseViewMatrix();
-			m_mP_perspective		= m_camera->GetProjectionMatrix();
+			const RenderCamera& camera = m_snapshot->camera;
+
+			m_nearPlane				= camera.nearPlane;
+			m_farPlane				= camera.farPlane;
+			m_mV					= camera.view;
+			m_mV_base				= camera.baseView;
+			m_mP_perspective		= camera.projection;
 			m_mP_orthographic		= Matrix::CreateOrthographicLH((float)Settings::Get().GetResolutionWidth(), (float)Settings::Get().GetResolutionHeight(), m_nearPlane, m_farPlane);		
 			m_wvp_perspective		= m_mV * m_mP_perspective;
 			m_wvp_baseOrthographic	= m_mV_base * m_mP_orthographic;
-			m_nearPlane				= m_camera->GetNearPlane();
-			m_farPlane				= m_camera->GetFarPlane();
+
+			Textures_Stream();
 
 			// If there is nothing to render clear to camera's color and present
-			if (m_renderables.empty())
+			if (m_snapshot->items.empty())
 			{
-				m_rhi->Clear(m_camera->GetClearColor());
+				m_rhi->Clear(camera.clearColor);
 				m_rhi->Present();
 				return;
 			}
 
-			Pass_DepthDirectionalLight(m_directionalLight);
+			Pass_DepthDirectionalLight(m_snapshot->GetDirectionalLight());
 		
 			Pass_GBuffer();
-			
-			Pass_PreLight(
-				m_gbuffer->GetShaderResource(GBuffer_Target_Normal),	// IN:	Texture			- Normal
-				m_gbuffer->GetShaderResource(GBuffer_Target_Depth),		// IN:	Texture			- Depth
-				m_texNoiseMap->GetShaderResource(),						// IN:	Texture			- Normal noise
-				m_renderTexPing.get(),									// IN:	Render texture		
-				m_renderTexShadowing.get()								// OUT: Render texture	- Shadowing (Shadow mapping + SSAO)
-			);
 
-			Pass_Light(
-				m_renderTexShadowing->GetShaderResourceView(),	// IN:	Texture			- Shadowing (Shadow mapping + SSAO)
-				m_renderTexPing.get()							// OUT: Render texture	- Result
-			);
+			// Everything after the G-Buffer is full-screen and goes through the render graph
+			m_quad->SetBuffer();
+			m_rhi->Set_PrimitiveTopology(PrimitiveTopology_TriangleList);
+			m_rhi->SetCullMode(Cull_Back);
 
-			Pass_PostLight(
-				m_renderTexPing,	// IN:	Render texture - Deferred pass result
-				m_renderTexPing2,	// IN:	Render texture - A spare one
-				m_renderTexPong		// OUT: Render texture - Result
-			);
+			RenderGraph_Declare();
+			m_renderGraph->Execute();
 		}		
 		else // If there is no camera, clear to black
 		{
@@ -375,17 +406,16 @@ namespace Directus
 		return Settings::Get().GetResolution();
 	}
 
+	void Renderer::TextureStreaming_SetBudget(unsigned long long bytes)	{ m_textureStreamer->SetBudget(bytes); }
+	unsigned long long Renderer::TextureStreaming_GetBudget()				{ return m_textureStreamer->GetBudget(); }
+	unsigned long long Renderer::TextureStreaming_GetMemory()				{ return m_textureStreamer->GetMemoryResident(); }
+
 	void Renderer::Clear()
 	{
-		m_renderables.clear();
-		m_renderables.shrink_to_fit();
-
 		m_lights.clear();
 		m_lights.shrink_to_fit();
 
-		m_directionalLight	= nullptr;
 		m_skybox			= nullptr;
-		m_lineRenderer		= nullptr;
 		m_camera			= nullptr;
 	}
 
@@ -399,290 +429,709 @@ namespace Directus
 		m_quad = make_unique<Rectangle>(m_context);
 		m_quad->Create(0, 0, (float)width, (float)height);
 
-		m_renderTexPing.reset();
-		m_renderTexPing = make_unique<D3D11_RenderTexture>(m_rhi, width, height, false, Texture_Format_R16G16B16A16_FLOAT);
+		// The render graph creates its textures on demand, drop the ones of the old resolution
+		m_frame.reset();
+		m_renderGraph->Pool_Clear();
+	}
+
+	void Renderer::RenderGraph_Declare()
+	{
+		const int width		= Settings::Get().GetResolutionWidth();
+		const int height	= Settings::Get().GetResolutionHeight();
+		const RenderGraph_TextureDesc descFrame(width, height, Texture_Format_R16G16B16A16_FLOAT);
+		const RenderGraph_TextureDesc descShadowing(int(width * 0.5f), int(height * 0.5f), Texture_Format_R32G32_FLOAT);
+
+		RenderGraph& graph = *m_renderGraph;
+		graph.Reset();
+
+		// Moved in, so that its memory can be reused once the light pass has read it
+		auto texFramePrevious	= graph.Texture_Import("Frame_Previous", move(m_frame));
+		auto texShadowingRaw	= graph.Texture_Create("Shadowing_Raw", descFrame);
+		auto texShadowing		= graph.Texture_Create("Shadowing", descShadowing);
+		auto texLight			= graph.Texture_Create("Light", descFrame);
+
+		// Shadow mapping + SSAO
+		graph.Pass_Add("Shadowing", true, {}, { texShadowingRaw }, [this, texShadowingRaw]()
+		{
+			Pass_Shadowing(
+				m_gbuffer->GetShaderResource(GBuffer_Target_Normal),
+				m_gbuffer->GetShaderResource(GBuffer_Target_Depth),
+				m_texNoiseMap->GetShaderResource(),
+				m_snapshot->GetDirectionalLight(),
+				m_renderGraph->Texture_Get(texShadowingRaw)
+			);
+		});
 
-		m_renderTexPing2.reset();
-		m_renderTexPing2 = make_unique<D3D11_RenderTexture>(m_rhi, width, height, false, Texture_Format_R16G16B16A16_FLOAT);
+		// Blur the shadows and the SSAO
+		graph.Pass_Add("Blur", true, { texShadowingRaw }, { texShadowing }, [this, texShadowingRaw, texShadowing]()
+		{
+			Pass_Blur(m_renderGraph->Texture_Get(texShadowingRaw)->GetShaderResourceView(), m_renderGraph->Texture_Get(texShadowing), Settings::Get().GetResolution());
+		});
 
-		m_renderTexPong.reset();
-		m_renderTexPong = make_unique<D3D11_RenderTexture>(m_rhi, width, height, false, Texture_Format_R16G16B16A16_FLOAT);
+		graph.Pass_Add("Light", true, { texShadowing, texFramePrevious }, { texLight }, [this, texShadowing, texFramePrevious, texLight]()
+		{
+			D3D11_RenderTexture* framePrevious = m_renderGraph->Texture_Get(texFramePrevious);
+			Pass_Light(
+				m_renderGraph->Texture_Get(texShadowing)->GetShaderResourceView(),
+				framePrevious ? framePrevious->GetShaderResourceView() : nullptr,
+				m_renderGraph->Texture_Get(texLight)
+			);
+		});
 
-		m_renderTexShadowing.reset();
-		m_renderTexShadowing = make_unique<D3D11_RenderTexture>(m_rhi, int(width * 0.5f), int(height * 0.5f), false, Texture_Format_R32G32_FLOAT);
+		// Post-processing, every effect reads the result of the one before it. When an effect is disabled
+		// its pass is culled and its output forwards to its input, so the chain stays intact.
+		auto texFrame		= texLight;
+		auto texBloomSpare	= graph.Texture_Create("Bloom_Spare", descFrame);
+		auto texBloom		= graph.Texture_Create("Bloom", descFrame);
+		graph.Pass_Add("Bloom", RenderFlags_IsSet(Render_Bloom), { texFrame }, { texBloom, texBloomSpare }, [this, texFrame, texBloom, texBloomSpare]()
+		{
+			Pass_Bloom(m_renderGraph->Texture_Get(texFrame), m_renderGraph->Texture_Get(texBloomSpare), m_renderGraph->Texture_Get(texBloom));
+		});
+		texFrame = texBloom;
+
+		auto PostEffect = [this, &graph, &texFrame, &descFrame](const char* name, RenderMode flag, void (Renderer::*pass)(void*, void*))
+		{
+			auto texIn	= texFrame;
+			auto texOut	= graph.Texture_Create(name, descFrame);
+			graph.Pass_Add(name, RenderFlags_IsSet(flag), { texIn }, { texOut }, [this, pass, texIn, texOut]()
+			{
+				(this->*pass)(m_renderGraph->Texture_Get(texIn)->GetShaderResourceView(), m_renderGraph->Texture_Get(texOut));
+			});
+			texFrame = texOut;
+		};
+		PostEffect("Correction",			Render_Correction,			&Renderer::Pass_Correction);
+		PostEffect("FXAA",					Render_FXAA,				&Renderer::Pass_FXAA);
+		PostEffect("ChromaticAberration",	Render_ChromaticAberration,	&Renderer::Pass_ChromaticAberration);
+		PostEffect("Sharpening",			Render_Sharpening,			&Renderer::Pass_Sharpening);
+
+		// Debug, drawn on top of the frame
+		graph.Pass_Add("Debug", true, { texFrame }, { texFrame }, [this, texFrame]()
+		{
+			SetRenderTarget(m_renderGraph->Texture_Get(texFrame), false);
+			Pass_DebugGBuffer();
+			Pass_Debug();
+		});
+
+		// The frame outlives the graph, it's displayed and read back by the next frame
+		graph.Texture_Extract(texFrame, &m_frame);
 	}
 
 	//= RENDERABLES ============================================================================================
-	void Renderer::Renderables_Acquire(const Variant& renderables)
+	void Renderer::Renderables_Acquire()
 	{
 		PROFILE_FUNCTION_BEGIN();
 
 		Clear();
-		auto renderablesVec = VARIANT_GET_FROM(vector<weak_ptr<Actor>>, renderables);
+		auto scene = m_context->GetSubsystem<Scene>();
+
+		// Get lights
+		for (IComponent* light : scene->GetComponentPool(ComponentType_Light)->GetAll())
+		{
+			m_lights.emplace_back(static_cast<Light*>(light));
+		}
+
+		// Get skybox
+		const auto& skyboxes	= scene->GetComponentPool(ComponentType_Skybox)->GetAll();
+		m_skybox				= !skyboxes.empty() ? static_cast<Skybox*>(skyboxes.front()) : nullptr;
+
+		// Get camera
+		Actor* camera	= scene->GetActor(scene->GetMainCamera());
+		m_camera		= camera ? camera->GetComponent<Camera>().lock().get() : nullptr;
+
+		PROFILE_FUNCTION_END();
+	}
+	//==========================================================================================================
 
-		for (const auto& renderable : renderablesVec)
+	//= SNAPSHOT ===============================================================================================
+	void Renderer::Snapshot_Capture()
+	{
+		PROFILE_FUNCTION_BEGIN();
+
+		RenderSnapshot& snapshot = m_snapshots[m_snapshotCapture];
+		snapshot.Clear();
+
+		// Camera
+		if (m_camera)
 		{
-			Actor* actor = renderable.lock().get();
-			if (!actor)
+			RenderCamera& camera	= snapshot.camera;
+			camera.view				= m_camera->GetViewMatrix();
+			camera.baseView			= m_camera->GetBaseViewMatrix();
+			camera.projection		= m_camera->GetProjectionMatrix();
+			camera.position			= m_camera->GetTransform()->GetPosition();
+			camera.clearColor		= m_camera->GetClearColor();
+			camera.nearPlane		= m_camera->GetNearPlane();
+			camera.farPlane			= m_camera->GetFarPlane();
+			camera.frustum.Construct(camera.view, camera.projection, camera.farPlane);
+			snapshot.hasCamera		= true;
+		}
+
+		// Lights (first, the shadow casters depend on the directional light)
+		Light* directionalLight = nullptr;
+		vector<BoundingBox> cascades;
+		for (Light* light : m_lights)
+		{
+			snapshot.lights.emplace_back();
+			RenderLight& entry	= snapshot.lights.back();
+			entry.type			= light->GetLightType();
+			entry.color			= light->GetColor();
+			entry.position		= light->GetTransform()->GetPosition();
+			entry.direction		= light->GetDirection();
+			entry.intensity		= light->GetIntensity();
+			entry.range			= light->GetRange();
+			entry.angle			= light->GetAngle();
+			entry.castShadows	= light->GetCastShadows();
+
+			if (entry.type != LightType_Directional)
 				continue;
 
-			// Get renderables
-			m_renderables.emplace_back(actor);
+			// The cascades follow the camera
+			cascades.clear();
+			if (m_camera)
+			{
+				entry.view = light->ComputeViewMatrix();
+				for (unsigned int i = 0; i < light->ShadowMap_GetCount(); i++)
+				{
+					cascades.emplace_back(light->ShadowMap_ComputeBounds(i));
+					entry.projections.emplace_back(light->ShadowMap_ComputeProjectionMatrix(i));
+				}
+			}
+			entry.splits				= Vector4(light->ShadowMap_GetSplit(0), light->ShadowMap_GetSplit(1), 0.0f, 0.0f);
+			entry.shadowMapResolution	= (float)light->ShadowMap_GetResolution();
+			entry.shadowMaps			= light->ShadowMap_GetAll();
+			snapshot.directionalLight	= (int)snapshot.lights.size() - 1;
+			directionalLight			= light;
+		}
+		bool shadows = m_camera && directionalLight && directionalLight->GetCastShadows() && !cascades.empty();
+
+		// Renderables, only the ones the camera can see, plus the ones that can cast a shadow into what it sees
+		m_cullVisible.clear();
+		m_cullCasters.clear();
+		float shadowReach = 0.0f;
+		if (m_camera)
+		{
+			AABBTree* spatialIndex = m_context->GetSubsystem<Scene>()->GetSpatialIndex();
+			spatialIndex->Query(snapshot.camera.frustum, &m_cullVisible);
 
-			// Get lights
-			if (auto light = actor->GetComponent<Light>().lock())
+			if (shadows)
 			{
-				m_lights.emplace_back(light.get());
-				if (light->GetLightType() == LightType_Directional)
+				// A sphere around the largest cascade (a camera centered box), anything beyond that is clipped anyway
+				shadowReach = directionalLight->ShadowMap_GetExtents((unsigned int)cascades.size() - 1) * 1.7320508f + 1.0f;
+				spatialIndex->Query(snapshot.camera.position, shadowReach, &m_cullCasters);
+			}
+
+			// Casters which are also visible are captured only once
+			sort(m_cullVisible.begin(), m_cullVisible.end());
+			m_cullCasters.erase(remove_if(m_cullCasters.begin(), m_cullCasters.end(), [this](void* renderable)
+			{
+				return binary_search(m_cullVisible.begin(), m_cullVisible.end(), renderable);
+			}), m_cullCasters.end());
+		}
+
+		unsigned int visibleCount	= (unsigned int)m_cullVisible.size();
+		Vector3 shadowExtrusion		= shadows ? snapshot.GetDirectionalLight()->direction * (shadowReach * 2.0f) : Vector3::Zero;
+		snapshot.items.resize(m_cullVisible.size() + m_cullCasters.size());
+		m_context->GetSubsystem<Threading>()->ParallelFor(0, (unsigned int)snapshot.items.size(), 0, [this, &snapshot, visibleCount, &shadowExtrusion](unsigned int i)
+		{
+			RenderItem& item		= snapshot.items[i];
+			Renderable* renderable	= static_cast<Renderable*>(i < visibleCount ? m_cullVisible[i] : m_cullCasters[i - visibleCount]);
+
+			item.model			= renderable->Geometry_ModelShared();
+			item.material		= renderable->Material_RefShared();
+			item.visible		= i < visibleCount;
+			item.castShadows	= renderable->GetCastShadows();
+			if (!item.model || !item.material || (!item.visible && !item.castShadows))
+			{
+				item.model = nullptr; // Dropped below
+				return;
+			}
+			item.aabb = renderable->Geometry_BB();
+
+			// Not visible, so it only matters if its shadow (its box, extruded along the light direction) can land on something that is
+			if (!item.visible)
+			{
+				BoundingBox shadow = item.aabb;
+				shadow.Merge(BoundingBox(item.aabb.GetMin() + shadowExtrusion, item.aabb.GetMax() + shadowExtrusion));
+				if (snapshot.camera.frustum.CheckCube(shadow.GetCenter(), shadow.GetExtents()) == Outside)
 				{
-					m_directionalLight = light.get();
+					item.model = nullptr;
+					return;
 				}
 			}
 
-			// Get skybox
-			if (auto skybox = actor->GetComponent<Skybox>().lock())
+			item.shader			= item.material->GetShader().lock();
+			item.world			= renderable->GetTransform()->GetWorldTransform();
+			item.indexCount		= renderable->Geometry_IndexCount();
+			item.indexOffset	= renderable->Geometry_IndexOffset();
+			item.vertexOffset	= renderable->Geometry_VertexOffset();
+			item.depth			= Vector3::Length(item.aabb.GetCenter(), snapshot.camera.position) / Max(snapshot.camera.farPlane, 1.0f);
+		});
+		snapshot.items.erase(remove_if(snapshot.items.begin(), snapshot.items.end(), [](const RenderItem& item) { return !item.model; }), snapshot.items.end());
+
+		// Compact IDs, resource IDs are 32-bit and wouldn't fit in the keys without colliding
+		m_keyShaders.clear();
+		m_keyMaterials.clear();
+		m_keyMeshes.clear();
+		auto compact = [](auto& ids, auto id) { return ids.emplace(id, (unsigned int)ids.size()).first->second; };
+		for (unsigned int i = 0; i < (unsigned int)snapshot.items.size(); i++)
+		{
+			RenderItem& item	= snapshot.items[i];
+			item.idShader		= item.shader ? compact(m_keyShaders, item.shader->GetResourceID()) : 0;
+			item.idMaterial		= compact(m_keyMaterials, item.material->GetResourceID());
+			item.idMesh			= compact(m_keyMeshes, ((unsigned long long)item.model->GetResourceID() << 32) | item.indexOffset);
+
+			// Opaque, sorted by state (so that the pass rebinds as little as possible) and then front to back
+			if (item.visible && item.shader && item.material->GetOpacity() >= 1.0f)
 			{
-				m_skybox = skybox.get();
-				m_lineRenderer = actor->GetComponent<LineRenderer>().lock().get(); // Hush hush...
+				snapshot.queueOpaque.Add(RenderQueue::ComputeKey(RenderPass_Opaque, item.idShader, item.idMaterial, item.idMesh, item.depth), i);
 			}
 
-			// Get camera
-			if (auto camera = actor->GetComponent<Camera>().lock())
+			snapshot.queueDebug.Add(RenderQueue::ComputeKey(RenderPass_Debug, 0, 0, 0, item.depth), i);
+		}
+		snapshot.queueOpaque.Sort();
+
+		// Shadow casters, culled against every cascade in light space (where a cascade is a box).
+		// Only the geometry is bound for depth, so that's what they are sorted by.
+		if (shadows)
+		{
+			RenderLight& light = snapshot.lights[snapshot.directionalLight];
+			light.casters.resize(cascades.size());
+
+			// A cascade per task, unless there are too few items for a cascade to be worth one
+			unsigned int cascadeCount	= (unsigned int)cascades.size();
+			unsigned int grain			= snapshot.items.size() < PARALLEL_MIN_GRAIN ? cascadeCount : 1;
+			m_context->GetSubsystem<Threading>()->ParallelFor(0, cascadeCount, grain, [&snapshot, &light, &cascades](unsigned int cascade)
+			{
+				RenderQueue& casters = light.casters[cascade];
+				for (unsigned int i = 0; i < (unsigned int)snapshot.items.size(); i++)
+				{
+					const RenderItem& item = snapshot.items[i];
+
+					// Skip meshes that don't cast shadows and transparent meshes (for now)
+					if (!item.castShadows || item.material->GetOpacity() < 1.0f)
+						continue;
+
+					if (cascades[cascade].IsInside(item.aabb.Transformed(light.view)) != Outside)
+					{
+						casters.Add(RenderQueue::ComputeKey(RenderPass_Shadow, 0, 0, item.idMesh, item.depth), i);
+					}
+				}
+				casters.Sort();
+			});
+		}
+
+		// Environment
+		snapshot.environment = m_skybox ? m_skybox->GetTexture() : nullptr;
+
+		// Debug lines, they come from the simulation so they have to be captured too
+		if (m_flags & Render_Physics)
+		{
+			g_physics->DebugDraw();
+			if (g_physics->GetPhysicsDebugDraw()->IsDirty())
 			{
-				m_camera = camera.get();
+				const auto& lines = g_physics->GetPhysicsDebugDraw()->GetLines();
+				snapshot.lines.insert(snapshot.lines.end(), lines.begin(), lines.end());
 			}
 		}
-		Renderables_Sort(&m_renderables);
+
+		if ((m_flags & Render_PickingRay) && m_camera)
+		{
+			auto lines = m_camera->GetPickingRay();
+			snapshot.lines.insert(snapshot.lines.end(), lines.begin(), lines.end());
+		}
+
+		m_snapshotCaptured = true;
 
 		PROFILE_FUNCTION_END();
 	}
 
-	void Renderer::Renderables_Sort(vector<Actor*>* renderables)
+	void Renderer::Snapshot_Swap()
 	{
-		if (renderables->size() <= 1)
+		if (!m_snapshotCaptured)
 			return;
 
-		sort(renderables->begin(), renderables->end(),[](Actor* a, Actor* b)
-		{
-			// Get renderable component
-			auto a_renderable = a->GetRenderable_PtrRaw();
-			auto b_renderable = b->GetRenderable_PtrRaw();
-
-			// Validate renderable components
-			if (!a_renderable || !b_renderable)
-				return false;
-
-			// Get geometry parents
-			auto a_geometryModel = a_renderable->Geometry_Model();
-			auto b_geometryModel = b_renderable->Geometry_Model();
-
-			// Validate geometry parents
-			if (!a_geometryModel || !b_geometryModel)
-				return false;
-
-			// Get materials
-			auto a_material = a_renderable->Material_Ref();
-			auto b_material = b_renderable->Material_Ref();
-
-			if (!a_material || !b_material)
-				return false;
-
-			// Get key for models
-			auto a_keyModel = a_geometryModel->GetResourceID();
-			auto b_keyModel = b_geometryModel->GetResourceID();
-
-			// Get key for shaders
-			auto a_keyShader = a_material->GetShader().lock()->GetResourceID();
-			auto b_keyShader = b_material->GetShader().lock()->GetResourceID();
-
-			// Get key for materials
-			auto a_keyMaterial = a_material->GetResourceID();
-			auto b_keyMaterial = b_material->GetResourceID();
-
-			auto a_key = 
-				(((unsigned long long)a_keyModel)		<< 48u)	| 
-				(((unsigned long long)a_keyShader)		<< 32u)	|
-				(((unsigned long long)a_keyMaterial)	<< 16u);
-
-			auto b_key = 
-				(((unsigned long long)b_keyModel)		<< 48u)	|
-				(((unsigned long long)b_keyShader)		<< 32u)	|
-				(((unsigned long long)b_keyMaterial)	<< 16u);
-	
-			return a_key < b_key;
-		});
+		m_snapshotCaptured	= false;
+		m_snapshotRender	= m_snapshotCapture;
+		m_snapshotCapture	= (m_snapshotCapture + 1) % 2;
 	}
 	//==========================================================================================================
 
 	//= PASSES =================================================================================================
-	void Renderer::Pass_DepthDirectionalLight(Light* light)
+	void Renderer::Textures_Stream()
 	{
-		if (!light || !light->GetCastShadows())
-			return;
-
 		PROFILE_FUNCTION_BEGIN();
 
-		m_rhi->EventBegin("Pass_DepthDirectionalLight");
-		m_rhi->EnableDepth(true);
-		m_shaderLightDepth->Bind();
+		// Make the mips which loaded resident, nothing is being recorded at this point
+		vector<StreamedMips> loaded;
+		{
+			lock_guard<mutex> lock(m_texturesLoadedMutex);
+			loaded.swap(m_texturesLoaded);
+		}
+		for (const auto& mips : loaded)
+		{
+			mips.texture->Stream_Apply(mips.mip, mips.shaderResource);
+			m_textureStreamer->SetResident(mips.handle, mips.texture->GetMipResident());
+			g_resourceMng->UpdateMemory(mips.texture.get());
+		}
+		loaded.clear();
 
-		for (unsigned int i = 0; i < light->ShadowMap_GetCount(); i++)
+		// Forget the textures which were unloaded (or failed to stream)
+		for (auto it = m_texturesStreamed.begin(); it != m_texturesStreamed.end();)
 		{
-			light->ShadowMap_SetRenderTarget(i);
-			m_rhi->EventBegin("Pass_ShadowMap_" + to_string(i));
-			for (const auto& actor : m_renderables)
+			auto texture = m_texturesStreamedHandles[it->second].lock();
+			if (texture && texture->IsStreamable())
 			{
-				// Get renderable and material
-				Renderable* obj_renderable = actor->GetRenderable_PtrRaw();
-				Material* obj_material = obj_renderable ? obj_renderable->Material_Ref() : nullptr;
+				++it;
+				continue;
+			}
 
-				if (!obj_renderable || !obj_material)
-					continue;
+			m_textureStreamer->Remove(it->second);
+			m_texturesStreamedHandles[it->second].reset();
+			it = m_texturesStreamed.erase(it);
+		}
 
-				// Get geometry
-				Model* obj_geometry = obj_renderable->Geometry_Model();
-				if (!obj_geometry)
+		// Request the mips the visible items need, assuming that their textures span them once
+		const Vector3& cameraPosition	= m_snapshot->camera.position;
+		float projectionScale			= m_mP_perspective.m11;
+		float viewportHeight			= (float)Settings::Get().GetResolutionHeight();
+		for (const auto& item : m_snapshot->items)
+		{
+			if (!item.visible || !item.material)
+				continue;
+
+			float screenSize = TextureStreamer::ComputeScreenSize(item.aabb, cameraPosition, projectionScale, viewportHeight);
+			for (const auto& textureType : item.material->GetTextures())
+			{
+				RHI_Texture* texture = textureType.second.get();
+				if (!texture || texture->GetLoadState() != LoadState_Completed || !texture->IsStreamable())
 					continue;
 
-				// Bind geometry
-				if (m_currentlyBoundGeometry != obj_geometry->GetResourceID())
+				auto it = m_texturesStreamed.find(texture);
+				if (it == m_texturesStreamed.end())
 				{
-					obj_geometry->Geometry_Bind();
-					m_rhi->Set_PrimitiveTopology(PrimitiveTopology_TriangleList);
-					m_currentlyBoundGeometry = obj_geometry->GetResourceID();
+					unsigned int handle = m_textureStreamer->Add(texture->GetWidth(), texture->GetHeight(), texture->GetMipCount(), texture->GetChannels(), texture->GetMipResident());
+					if (handle >= (unsigned int)m_texturesStreamedHandles.size())
+					{
+						m_texturesStreamedHandles.resize(handle + 1);
+					}
+					m_texturesStreamedHandles[handle] = textureType.second;
+					it = m_texturesStreamed.emplace(texture, handle).first;
 				}
 
-				// Skip meshes that don't cast shadows
-				if (!obj_renderable->GetCastShadows())
-					continue;
+				m_textureStreamer->Request(it->second, TextureStreamer::ComputeMip(texture->GetWidth(), texture->GetHeight(), texture->GetMipCount(), screenSize));
+			}
+		}
 
-				// Skip transparent meshes (for now)
-				if (obj_material->GetOpacity() < 1.0f)
-					continue;
+		// Read the mips on the workers, they are made resident by a following frame
+		auto threading = m_context->GetSubsystem<Threading>();
+		for (const auto& change : m_textureStreamer->Update())
+		{
+			auto texture = m_texturesStreamedHandles[change.handle].lock();
+			if (!texture)
+				continue;
 
-				// skip objects outside of the view frustum
-				//if (!m_directionalLight->IsInViewFrustrum(obj_renderable, i))
-					//continue;
+			threading->AddTask([this, texture, change]()
+			{
+				auto shaderResource = texture->Stream_Load(change.mip);
 
-				m_shaderLightDepth->Bind_Buffer(actor->GetTransform_PtrRaw()->GetWorldTransform() * light->ComputeViewMatrix() * light->ShadowMap_ComputeProjectionMatrix(i));
-				m_rhi->DrawIndexed(obj_renderable->Geometry_IndexCount(), obj_renderable->Geometry_IndexOffset(), obj_renderable->Geometry_VertexOffset());
-				Profiler::Get().m_drawCalls++;
-			}
-			m_rhi->EventEnd();
+				lock_guard<mutex> lock(m_texturesLoadedMutex);
+				m_texturesLoaded.push_back({ change.handle, change.mip, texture, shaderResource });
+			}, m_texturesLoadTasks);
 		}
 
-		// Reset pipeline state tracking
-		m_currentlyBoundGeometry = 0;
-		
-		m_rhi->EnableDepth(false);
-		m_rhi->EventEnd();
-
 		PROFILE_FUNCTION_END();
 	}
 
-	void Renderer::Pass_GBuffer()
+	unsigned int Renderer::Record_Parallel(unsigned int count, const function<void(RecordChunk&)>& plan, const function<void(RecordChunk&)>& record)
 	{
-		if (!m_rhi)
-			return;
+		if (count == 0)
+			return 0;
 
-		PROFILE_FUNCTION_BEGIN();
-		m_rhi->EventBegin("Pass_GBuffer");
-
-		m_gbuffer->SetAsRenderTarget();
-		m_gbuffer->Clear();
+		// A few chunks per thread, but not so small that a chunk isn't worth a task
+		auto threading			= m_context->GetSubsystem<Threading>();
+		unsigned int chunkCount	= (threading->GetWorkerCount() + 1) * 2;
+		unsigned int grain		= Max((count + chunkCount - 1) / chunkCount, RECORD_MIN_GRAIN);
+		chunkCount				= (count + grain - 1) / grain;
 
-		// Bind sampler 
-		m_rhi->Bind_Sampler(0, m_samplerAnisotropicWrapAlways->GetSamplerState());
-
-		for (auto actor : m_renderables)
+		if (m_recordChunks.size() < chunkCount)
 		{
-			// Get renderable and material
-			Renderable* obj_renderable	= actor->GetRenderable_PtrRaw();
-			Material* obj_material		= obj_renderable ? obj_renderable->Material_Ref() : nullptr;
+			m_recordChunks.resize(chunkCount);
+		}
 
-			if (!obj_renderable || !obj_material)
-				continue;
+		auto planChunk = [&plan](RecordChunk& chunk, unsigned int begin, unsigned int end)
+		{
+			chunk.begin				= begin;
+			chunk.end				= end;
+			chunk.uploadSize		= 0;
+			chunk.upload			= RHI_UploadAllocation();
+			chunk.meshesRendered	= 0;
+			chunk.meshesInstanced	= 0;
+			chunk.runs.clear();
+			chunk.commandList.Clear();
+			plan(chunk);
+		};
 
-			// Get geometry and shader
-			Model* obj_geometry			= obj_renderable->Geometry_Model();
-			ShaderVariation* obj_shader	= obj_material->GetShader().lock().get();
+		threading->ParallelFor(0, chunkCount, 1, [this, count, grain, &planChunk](unsigned int i)
+		{
+			planChunk(m_recordChunks[i], i * grain, Min(i * grain + grain, count));
+		});
 
-			if (!obj_geometry || !obj_shader)
+		// A chunk has to fit in the ring on its own, halve the ones that don't until they do
+		for (unsigned int i = 0; i < chunkCount;)
+		{
+			RecordChunk& chunk = m_recordChunks[i];
+			if (chunk.uploadSize <= m_uploadRing->GetSize() || chunk.end - chunk.begin <= 1)
+			{
+				i++;
 				continue;
+			}
 
-			// Skip transparent objects (for now)
-			if (obj_material->GetOpacity() < 1.0f)
-				continue;
+			unsigned int begin	= chunk.begin;
+			unsigned int middle	= chunk.begin + (chunk.end - chunk.begin) / 2;
+			unsigned int end	= chunk.end;
+			m_recordChunks.insert(m_recordChunks.begin() + i + 1, RecordChunk());
+			chunkCount++;
+			planChunk(m_recordChunks[i], begin, middle);
+			planChunk(m_recordChunks[i + 1], middle, end);
+		}
 
-			// Skip objects outside of the view frustum
-			if (!m_camera->IsInViewFrustrum(obj_renderable))
-				continue;
+		// Chunks are recorded in groups that fit in the ring, each group is uploaded with a single map
+		for (unsigned int first = 0; first < chunkCount;)
+		{
+			unsigned int last		= first;
+			unsigned int groupSize	= 0;
+			while (last < chunkCount && (last == first || groupSize + m_recordChunks[last].uploadSize <= m_uploadRing->GetSize()))
+			{
+				groupSize += m_recordChunks[last].uploadSize;
+				last++;
+			}
 
-			// set face culling (changes only if required)
-			m_rhi->SetCullMode(obj_material->GetCullMode());
+			RHI_UploadAllocation block;
+			if (groupSize != 0)
+			{
+				m_uploadRing->Begin(groupSize);
+				block = m_uploadRing->Allocate(groupSize);
+				if (!block.data)
+				{
+					// Only a single chunk (of a single item) too large for the ring gets here, skip just that
+					m_uploadRing->End();
+					LOG_ERROR("Renderer::Record_Parallel: Failed to upload per object data.");
+					first = last;
+					continue;
+				}
 
-			// Bind geometry
-			if (m_currentlyBoundGeometry != obj_geometry->GetResourceID())
-			{	
-				obj_geometry->Geometry_Bind();
-				m_currentlyBoundGeometry = obj_geometry->GetResourceID();
+				for (unsigned int i = first; i < last; i++)
+				{
+					m_recordChunks[i].upload = RHI_UploadRing::Allocate(&block, m_recordChunks[i].uploadSize);
+				}
 			}
 
-			// Bind shader
-			if (m_currentlyBoundShader != obj_shader->GetResourceID())
+			threading->ParallelFor(first, last, 1, [this, &record](unsigned int i) { record(m_recordChunks[i]); });
+			m_uploadRing->End();
+
+			for (unsigned int i = first; i < last; i++)
 			{
-				obj_shader->Bind();
-				obj_shader->Bind_PerFrameBuffer(m_camera);
-				m_currentlyBoundShader = obj_shader->GetResourceID();
+				m_recordChunks[i].commandList.Submit(m_rhi);
 			}
 
-			// Bind material
-			if (m_currentlyBoundMaterial != obj_material->GetResourceID())
+			first = last;
+		}
+
+		return chunkCount;
+	}
+
+	void Renderer::Pass_DepthDirectionalLight(const RenderLight* light)
+	{
+		if (!light || !light->castShadows || light->projections.size() < light->shadowMaps.size() || light->casters.size() < light->shadowMaps.size())
+			return;
+
+		PROFILE_FUNCTION_BEGIN();
+
+		m_rhi->EventBegin("Pass_DepthDirectionalLight");
+		m_rhi->EnableDepth(true);
+		m_shaderLightDepth->Bind();
+
+		for (unsigned int i = 0; i < (unsigned int)light->shadowMaps.size(); i++)
+		{
+			light->shadowMaps[i]->SetAsRenderTarget();
+			light->shadowMaps[i]->Clear(0.0f, 0.0f, 0.0f, 1.0f);
+			Matrix viewProjection	= light->view * light->projections[i];
+			const auto& entries		= light->casters[i].GetEntries();
+
+			m_rhi->EventBegin("Pass_ShadowMap_" + to_string(i));
+			Record_Parallel((unsigned int)entries.size(),
+			[](RecordChunk& chunk)
 			{
-				obj_shader->Bind_PerMaterialBuffer(obj_material);
-				m_rhi->Bind_Textures(RESOURCES_FROM_VECTOR(obj_material->GetShaderResources()));
-				m_currentlyBoundMaterial = obj_material->GetResourceID();
-			}
+				// One matrix per caster
+				chunk.uploadSize = (chunk.end - chunk.begin) * RHI_UploadRing::GetAlignedSize(sizeof(Matrix));
+			},
+			[this, &entries, &viewProjection](RecordChunk& chunk)
+			{
+				RHI_CommandList* commandList	= &chunk.commandList;
+				unsigned int boundGeometry		= 0;
 
-			// UPDATE PER OBJECT BUFFER
-			auto mWorld	= actor->GetTransform_PtrRaw()->GetWorldTransform();
-			obj_shader->Bind_PerObjectBuffer(mWorld, m_mV, m_mP_perspective);
-		
-			// Render			
-			m_rhi->DrawIndexed(obj_renderable->Geometry_IndexCount(), obj_renderable->Geometry_IndexOffset(), obj_renderable->Geometry_VertexOffset());
-			Profiler::Get().m_meshesRendered++;
+				commandList->Set_PrimitiveTopology(PrimitiveTopology_TriangleList);
+				for (unsigned int entry = chunk.begin; entry < chunk.end; entry++)
+				{
+					const RenderItem& item	= m_snapshot->items[entries[entry].drawIndex];
+					Model* obj_geometry		= item.model.get();
 
-		} // Actor/MESH ITERATION
+					// Bind geometry
+					if (boundGeometry != obj_geometry->GetResourceID())
+					{
+						obj_geometry->Geometry_Bind(commandList);
+						boundGeometry = obj_geometry->GetResourceID();
+					}
 
-		// Reset pipeline state tracking
-		m_currentlyBoundGeometry	= 0;
-		m_currentlyBoundShader		= 0;
-		m_currentlyBoundMaterial	= 0;
+					RHI_UploadAllocation allocation = RHI_UploadRing::Allocate(&chunk.upload, sizeof(Matrix));
+					if (!allocation.data)
+						break;
 
+					*(Matrix*)allocation.data = item.world * viewProjection;
+					m_uploadRing->SetVS(commandList, 0, allocation);
+					commandList->DrawIndexed(item.indexCount, item.indexOffset, item.vertexOffset);
+				}
+			});
+			m_rhi->EventEnd();
+		}
+		
+		m_rhi->EnableDepth(false);
 		m_rhi->EventEnd();
+
 		PROFILE_FUNCTION_END();
 	}
 
-	void Renderer::Pass_PreLight(void* inTextureNormal, void* inTextureDepth, void* inTextureNormalNoise, void* inRenderTexure, void* outRenderTextureShadowing)
+	void Renderer::Pass_GBuffer()
 	{
+		if (!m_rhi)
+			return;
+
 		PROFILE_FUNCTION_BEGIN();
-		m_rhi->EventBegin("Pass_PreLight");
+		m_rhi->EventBegin("Pass_GBuffer");
 
-		m_quad->SetBuffer();
+		m_gbuffer->SetAsRenderTarget();
+		m_gbuffer->Clear();
+
+		// Bind sampler 
+		m_rhi->Bind_Sampler(0, m_samplerAnisotropicWrapAlways->GetSamplerState());
 		m_rhi->Set_PrimitiveTopology(PrimitiveTopology_TriangleList);
-		m_rhi->SetCullMode(Cull_Back);
 
-		// Shadow mapping + SSAO
-		Pass_Shadowing(inTextureNormal, inTextureDepth, inTextureNormalNoise, m_directionalLight, inRenderTexure);
+		// Visible, opaque and with a shader, as sorted by the queue.
+		// Consecutive entries of the same mesh, material and shader are drawn as instances of the first.
+		// Runs don't cross chunks, so a chunk only ever depends on its own state.
+		const auto& entries		= m_snapshot->queueOpaque.GetEntries();
+		Matrix viewProjection	= m_mV * m_mP_perspective;
+		unsigned int chunkCount = Record_Parallel((unsigned int)entries.size(),
+		[this, &entries](RecordChunk& chunk)
+		{
+			chunk.uploadSize			= ShaderVariation::GetUploadSize_PerFrame();
+			unsigned int lastMaterial	= 0;
+			for (unsigned int i = chunk.begin; i < chunk.end;)
+			{
+				const RenderItem& item = m_snapshot->items[entries[i].drawIndex];
 
-		// Blur the shadows and the SSAO
-		Pass_Blur(((D3D11_RenderTexture*)inRenderTexure)->GetShaderResourceView(), outRenderTextureShadowing, Settings::Get().GetResolution());
+				unsigned int next = i + 1;
+				for (; next < chunk.end && next - i < SHADER_MAX_INSTANCES; next++)
+				{
+					const RenderItem& instance = m_snapshot->items[entries[next].drawIndex];
+					if (instance.idMesh != item.idMesh || instance.idMaterial != item.idMaterial || instance.idShader != item.idShader)
+						break;
+				}
+
+				if (i == chunk.begin || item.idMaterial != lastMaterial)
+				{
+					chunk.uploadSize	+= ShaderVariation::GetUploadSize_PerMaterial();
+					lastMaterial		= item.idMaterial;
+				}
+				chunk.uploadSize += ShaderVariation::GetUploadSize_PerObject(next - i);
+				chunk.runs.push_back({ i, next - i });
+				i = next;
+			}
+		},
+		[this, &entries, &viewProjection](RecordChunk& chunk)
+		{
+			RHI_CommandList* commandList	= &chunk.commandList;
+			unsigned int boundGeometry		= 0;
+			unsigned int boundShader		= 0;
+			unsigned int lastMaterial		= 0;
+			void* textures[MATERIAL_SHADER_RESOURCES];
+
+			RHI_UploadAllocation allocation;
+			if (!ShaderVariation::Upload_PerFrameBuffer(&chunk.upload, m_snapshot->camera.position, &allocation))
+				return;
+			ShaderVariation::Bind_PerFrameBuffer(commandList, m_uploadRing.get(), allocation);
+
+			for (const auto& run : chunk.runs)
+			{
+				// Get geometry, material and shader
+				const RenderItem& item		= m_snapshot->items[entries[run.entry].drawIndex];
+				Model* obj_geometry			= item.model.get();
+				Material* obj_material		= item.material.get();
+				ShaderVariation* obj_shader	= item.shader.get();
+
+				// Bind material (in the same order as planned, so that the block fits exactly)
+				if (run.entry == chunk.begin || item.idMaterial != lastMaterial)
+				{
+					if (!ShaderVariation::Upload_PerMaterialBuffer(&chunk.upload, obj_material, &allocation))
+						return;
+					ShaderVariation::Bind_PerMaterialBuffer(commandList, m_uploadRing.get(), allocation);
+
+					obj_material->GetShaderResources(textures);
+					commandList->Bind_Textures(0, MATERIAL_SHADER_RESOURCES, textures);
+					commandList->SetCullMode(obj_material->GetCullMode());
+					lastMaterial = item.idMaterial;
+				}
+
+				// Bind geometry
+				if (boundGeometry != obj_geometry->GetResourceID())
+				{	
+					obj_geometry->Geometry_Bind(commandList);
+					boundGeometry = obj_geometry->GetResourceID();
+				}
+
+				// Bind shader
+				if (boundShader != obj_shader->GetResourceID())
+				{
+					if (!obj_shader->Bind(commandList))
+						continue;
+					boundShader = obj_shader->GetResourceID();
+				}
+
+				// Upload and bind per object buffer (by offset)
+				Matrix* worlds = ShaderVariation::Upload_PerObjectBuffer(&chunk.upload, run.count, m_mV, viewProjection, &allocation);
+				if (!worlds)
+					return;
+
+				for (unsigned int instance = 0; instance < run.count; instance++)
+				{
+					worlds[instance] = m_snapshot->items[entries[run.entry + instance].drawIndex].world;
+				}
+				ShaderVariation::Bind_PerObjectBuffer(commandList, m_uploadRing.get(), allocation);
+		
+				// Render
+				if (run.count == 1)
+				{
+					commandList->DrawIndexed(item.indexCount, item.indexOffset, item.vertexOffset);
+				}
+				else
+				{
+					commandList->DrawIndexedInstanced(item.indexCount, run.count, item.indexOffset, item.vertexOffset);
+					chunk.meshesInstanced += run.count;
+				}
+				chunk.meshesRendered += run.count;
+			}
+		});
+
+		for (unsigned int i = 0; i < chunkCount; i++)
+		{
+			Profiler::Get().m_meshesRendered	+= m_recordChunks[i].meshesRendered;
+			Profiler::Get().m_meshesInstanced	+= m_recordChunks[i].meshesInstanced;
+		}
 
 		m_rhi->EventEnd();
 		PROFILE_FUNCTION_END();
 	}
 
-	void Renderer::Pass_Light(void* inTextureShadowing, void* outRenderTexture)
+	void Renderer::Pass_Light(void* inTextureShadowing, void* inTextureFramePrevious, void* outRenderTexture)
 	{
 		if (!m_shaderLight->IsCompiled())
 			return;
@@ -698,7 +1147,7 @@ namespace Directus
 		// Update buffers
 		m_shaderLight->Bind();
 		m_shaderLight->UpdateMatrixBuffer(Matrix::Identity, m_mV, m_mV_base, m_mP_perspective, m_mP_orthographic);
-		m_shaderLight->UpdateMiscBuffer(m_lights, m_camera);
+		m_shaderLight->UpdateMiscBuffer(m_snapshot->lights, m_snapshot->camera, m_uploadRing.get());
 		m_rhi->Bind_Sampler(0, m_samplerAnisotropicWrapAlways->GetSamplerState());
 
 		//= Update textures ===========================================================
@@ -709,8 +1158,8 @@ namespace Directus
 		m_texArray.emplace_back(m_gbuffer->GetShaderResource(GBuffer_Target_Depth));
 		m_texArray.emplace_back(m_gbuffer->GetShaderResource(GBuffer_Target_Specular));
 		m_texArray.emplace_back(inTextureShadowing);
-		m_texArray.emplace_back(m_renderTexPong->GetShaderResourceView()); // previous frame for SSR
-		m_texArray.emplace_back(m_skybox ? m_skybox->GetShaderResource() : nullptr);
+		m_texArray.emplace_back(inTextureFramePrevious); // SSR
+		m_texArray.emplace_back(m_snapshot->environment ? m_snapshot->environment->GetShaderResource() : nullptr);
 
 		m_rhi->Bind_Textures(RESOURCES_FROM_VECTOR(m_texArray));
 		//=============================================================================
@@ -721,65 +1170,6 @@ namespace Directus
 		PROFILE_FUNCTION_END();
 	}
 
-	void Renderer::Pass_PostLight(shared_ptr<D3D11_RenderTexture>& inRenderTexture1, shared_ptr<D3D11_RenderTexture>& inRenderTexture2, shared_ptr<D3D11_RenderTexture>& outRenderTexture)
-	{
-		PROFILE_FUNCTION_BEGIN();
-		m_rhi->EventBegin("Pass_PostLight");
-
-		m_quad->SetBuffer();
-		m_rhi->Set_PrimitiveTopology(PrimitiveTopology_TriangleList);
-		m_rhi->SetCullMode(Cull_Back);
-
-		// Keep track of render target swapping
-		bool swaped = false;
-		auto SwapTargets = [&swaped, &inRenderTexture1, &outRenderTexture]()
-		{
-			outRenderTexture.swap(inRenderTexture1);
-			swaped = !swaped;
-		};
-
-		// BLOOM
-		if (RenderFlags_IsSet(Render_Bloom))
-		{
-			Pass_Bloom(inRenderTexture1, inRenderTexture2, outRenderTexture);
-			SwapTargets();
-		}
-
-		// CORRECTION
-		if (RenderFlags_IsSet(Render_Correction))
-		{
-			Pass_Correction(inRenderTexture1->GetShaderResourceView(), outRenderTexture.get());
-			SwapTargets();
-		}
-
-		// FXAA
-		if (RenderFlags_IsSet(Render_FXAA))
-		{
-			Pass_FXAA(inRenderTexture1->GetShaderResourceView(), outRenderTexture.get());
-			SwapTargets();
-		}
-
-		// CHROMATIC ABERRATION
-		if (RenderFlags_IsSet(Render_ChromaticAberration))
-		{
-			Pass_ChromaticAberration(inRenderTexture1->GetShaderResourceView(), outRenderTexture.get());
-			SwapTargets();
-		}
-
-		// SHARPENING
-		if (RenderFlags_IsSet(Render_Sharpening))
-		{
-			Pass_Sharpening(inRenderTexture1->GetShaderResourceView(), outRenderTexture.get());
-		}
-
-		// DEBUG - Rendering continues on last bound target
-		Pass_DebugGBuffer();
-		Pass_Debug();
-
-		m_rhi->EventEnd();
-		PROFILE_FUNCTION_END();
-	}
-
 	void Renderer::Pass_Correction(void* inTexture, void* outTexture)
 	{
 		m_rhi->EventBegin("Pass_Correction");
@@ -836,41 +1226,45 @@ namespace Directus
 		m_rhi->EventEnd();
 	}
 
-	void Renderer::Pass_Bloom(shared_ptr<D3D11_RenderTexture>& inSourceTexture, shared_ptr<D3D11_RenderTexture>& inTextureSpare, shared_ptr<D3D11_RenderTexture>& outTexture)
+	void Renderer::Pass_Bloom(void* inSourceTexture, void* inTextureSpare, void* outTexture)
 	{
 		m_rhi->EventBegin("Pass_Bloom");
 
+		auto texSource	= (D3D11_RenderTexture*)inSourceTexture;
+		auto texSpare	= (D3D11_RenderTexture*)inTextureSpare;
+		auto texOut		= (D3D11_RenderTexture*)outTexture;
+
 		// Bright pass
-		SetRenderTarget(inTextureSpare.get(), false);
+		SetRenderTarget(texSpare, false);
 		m_shaderBloom_Bright->Bind();
 		m_shaderBloom_Bright->Bind_Buffer(m_wvp_baseOrthographic, Settings::Get().GetResolution());
 		m_rhi->Bind_Sampler(0, m_samplerLinearWrapAlways->GetSamplerState());
-		m_rhi->Bind_Texture(0, inSourceTexture->GetShaderResourceView());
+		m_rhi->Bind_Texture(0, texSource->GetShaderResourceView());
 		m_rhi->DrawIndexed(m_quad->GetIndexCount(), 0, 0);
 
 		// Horizontal Gaussian blur
-		SetRenderTarget(outTexture.get(), false);
+		SetRenderTarget(texOut, false);
 		m_shaderBlurGaussianH->Bind();
 		m_shaderBlurGaussianH->Bind_Buffer(m_wvp_baseOrthographic, Settings::Get().GetResolution());
 		m_rhi->Bind_Sampler(0, m_samplerLinearWrapAlways->GetSamplerState());
-		m_rhi->Bind_Texture(0, inTextureSpare->GetShaderResourceView());
+		m_rhi->Bind_Texture(0, texSpare->GetShaderResourceView());
 		m_rhi->DrawIndexed(m_quad->GetIndexCount(), 0, 0);
 
 		// Vertical Gaussian blur
-		SetRenderTarget(inTextureSpare.get(), false);
+		SetRenderTarget(texSpare, false);
 		m_shaderBlurGaussianV->Bind();
 		m_shaderBlurGaussianV->Bind_Buffer(m_wvp_baseOrthographic, Settings::Get().GetResolution());
 			m_rhi->Bind_Sampler(0, m_samplerLinearWrapAlways->GetSamplerState());
-		m_rhi->Bind_Texture(0, outTexture->GetShaderResourceView());
+		m_rhi->Bind_Texture(0, texOut->GetShaderResourceView());
 		m_rhi->DrawIndexed(m_quad->GetIndexCount(), 0, 0);
 
 		// Additive blending
-		SetRenderTarget(outTexture.get(), false);
+		SetRenderTarget(texOut, false);
 		m_shaderBloom_BlurBlend->Bind();
 		m_shaderBloom_BlurBlend->Bind_Buffer(m_wvp_baseOrthographic);
 		m_rhi->Bind_Sampler(0, m_samplerLinearWrapAlways->GetSamplerState());
-		m_rhi->Bind_Texture(0, inSourceTexture->GetShaderResourceView());
-		m_rhi->Bind_Texture(1, inTextureSpare->GetShaderResourceView());
+		m_rhi->Bind_Texture(0, texSource->GetShaderResourceView());
+		m_rhi->Bind_Texture(1, texSpare->GetShaderResourceView());
 		m_rhi->DrawIndexed(m_quad->GetIndexCount(), 0, 0);
 
 		m_rhi->EventEnd();
@@ -890,7 +1284,7 @@ namespace Directus
 		m_rhi->EventEnd();
 	}
 
-	void Renderer::Pass_Shadowing(void* inTextureNormal, void* inTextureDepth, void* inTextureNormalNoise, Light* inDirectionalLight, void* outRenderTexture)
+	void Renderer::Pass_Shadowing(void* inTextureNormal, void* inTextureDepth, void* inTextureNormalNoise, const RenderLight* inDirectionalLight, void* outRenderTexture)
 	{
 		if (!inDirectionalLight)
 			return;
@@ -907,11 +1301,9 @@ namespace Directus
 		m_texArray.emplace_back(inTextureNormal);
 		m_texArray.emplace_back(inTextureDepth);
 		m_texArray.emplace_back(inTextureNormalNoise);
-		if (inDirectionalLight)
+		for (unsigned int i = 0; i < 3; i++)
 		{
-			m_texArray.emplace_back(inDirectionalLight->ShadowMap_GetShaderResource(0));
-			m_texArray.emplace_back(inDirectionalLight->ShadowMap_GetShaderResource(1));
-			m_texArray.emplace_back(inDirectionalLight->ShadowMap_GetShaderResource(2));
+			m_texArray.emplace_back(i < inDirectionalLight->shadowMaps.size() ? inDirectionalLight->shadowMaps[i]->GetShaderResourceView() : nullptr);
 		}
 
 		// BUFFER
@@ -922,8 +1314,8 @@ namespace Directus
 			m_mV, 
 			m_mP_perspective,		
 			Settings::Get().GetResolution(), 
-			inDirectionalLight,
-			m_camera,
+			*inDirectionalLight,
+			m_snapshot->camera,
 			0
 		);
 		m_rhi->Bind_Sampler(0, m_samplerPointClampGreater->GetSamplerState());	// Shadow mapping
@@ -974,35 +1366,18 @@ namespace Directus
 		//= PRIMITIVES ===================================================================================
 		// Anything that is a bunch of vertices (doesn't have a vertex and and index buffer) gets rendered here
 		// by passing it's vertices (VertexPosCol) to the LineRenderer. Typically used only for debugging.
-		if (m_lineRenderer)
 		{
 			m_lineRenderer->ClearVertices();
 
-			// Physics
-			if (m_flags & Render_Physics)
-			{
-				g_physics->DebugDraw();
-				if (g_physics->GetPhysicsDebugDraw()->IsDirty())
-				{
-					m_lineRenderer->AddLines(g_physics->GetPhysicsDebugDraw()->GetLines());
-				}
-			}
-
-			// Picking ray
-			if (m_flags & Render_PickingRay)
-			{
-				m_lineRenderer->AddLines(m_camera->GetPickingRay());
-			}
+			// Physics & picking ray
+			m_lineRenderer->AddLines(m_snapshot->lines);
 
 			// bounding boxes
 			if (m_flags & Render_AABB)
 			{
-				for (const auto& renderableWeak : m_renderables)
+				for (const auto& entry : m_snapshot->queueDebug.GetEntries())
 				{
-					if (auto renderable = renderableWeak->GetRenderable_PtrRaw())
-					{
-						m_lineRenderer->AddBoundigBox(renderable->Geometry_BB(), Vector4(0.41f, 0.86f, 1.0f, 1.0f));
-					}
+					m_lineRenderer->AddBoundigBox(m_snapshot->items[entry.drawIndex].aabb, Vector4(0.41f, 0.86f, 1.0f, 1.0f));
 				}
 			}
 
@@ -1013,7 +1388,7 @@ namespace Directus
 				// Render
 				m_lineRenderer->SetBuffer();
 				m_shaderLine->Bind();
-				m_shaderLine->Bind_Buffer(Matrix::Identity, m_camera->GetViewMatrix(), m_camera->GetProjectionMatrix());
+				m_shaderLine->Bind_Buffer(Matrix::Identity, m_mV, m_mP_perspective);
 				m_rhi->Set_PrimitiveTopology(PrimitiveTopology_LineList);
 				m_rhi->Bind_Sampler(0, m_samplerLinearWrapAlways->GetSamplerState());
 				m_rhi->Bind_Texture(0, m_gbuffer->GetShaderResource(GBuffer_Target_Depth));
@@ -1033,7 +1408,7 @@ namespace Directus
 
 			m_grid->SetBuffer();
 			m_shaderGrid->Bind();
-			m_shaderGrid->Bind_Buffer(m_grid->ComputeWorldMatrix(m_camera->GetTransform()) * m_camera->GetViewMatrix() * m_camera->GetProjectionMatrix());
+			m_shaderGrid->Bind_Buffer(m_grid->ComputeWorldMatrix(m_snapshot->camera.position) * m_wvp_perspective);
 			m_rhi->Set_PrimitiveTopology(PrimitiveTopology_LineList);
 			m_rhi->Bind_Sampler(0, m_samplerAnisotropicWrapAlways->GetSamplerState());
 			m_rhi->Bind_Texture(0, m_gbuffer->GetShaderResource(GBuffer_Target_Depth));
@@ -1048,19 +1423,19 @@ namespace Directus
 			if (m_flags & Render_Light)
 			{
 				m_rhi->EventBegin("Lights");
-				for (auto* light : m_lights)
+				for (const auto& light : m_snapshot->lights)
 				{
-					Vector3 lightWorldPos = light->GetTransform()->GetPosition();
-					Vector3 cameraWorldPos = m_camera->GetTransform()->GetPosition();
+					Vector3 lightWorldPos = light.position;
+					Vector3 cameraWorldPos = m_snapshot->camera.position;
 
 					// Compute light screen space position and scale (based on distance from the camera)
-					Vector2 lightScreenPos	= m_camera->WorldToScreenPoint(lightWorldPos);
+					Vector2 lightScreenPos	= WorldToScreenPoint(lightWorldPos, m_wvp_perspective);
 					float distance			= Vector3::Length(lightWorldPos, cameraWorldPos);
 					float scale				= GIZMO_MAX_SIZE / distance;
 					scale					= Clamp(scale, GIZMO_MIN_SIZE, GIZMO_MAX_SIZE);
 
 					// Skip if the light is not in front of the camera
-					if (!m_camera->IsInViewFrustrum(lightWorldPos, Vector3(1.0f)))
+					if (m_snapshot->camera.frustum.CheckCube(lightWorldPos, Vector3(1.0f)) == Outside)
 						continue;
 
 					// Skip if the light if it's too small
@@ -1068,7 +1443,7 @@ namespace Directus
 						continue;
 
 					RHI_Texture* lightTex = nullptr;
-					LightType type = light->Getactor_PtrRaw()->GetComponent<Light>().lock()->GetLightType();
+					LightType type = light.type;
 					if (type == LightType_Directional)
 					{
 						lightTex = m_gizmoTexLightDirectional.get();
@@ -1147,6 +1522,6 @@ namespace Directus
 
 	const Vector4& Renderer::GetClearColor()
 	{
-		return m_camera ? m_camera->GetClearColor() : Vector4::Zero;
+		return (m_snapshot && m_snapshot->hasCamera) ? m_snapshot->camera.clearColor : Vector4::Zero;
 	}
 }
@@ -24,11 +24,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ===========================
 #include <memory>
 #include <vector>
+#include <unordered_map>
+#include <functional>
+#include <mutex>
 #include "../RHI/RHI_Definition.h"
 #include "../Core/Settings.h"
 #include "../Core/SubSystem.h"
 #include "../Math/Matrix.h"
 #include "../Resource/ResourceManager.h"
+#include "../RHI/RHI_UploadRing.h"
+#include "../RHI/RHI_CommandList.h"
+#include "RenderSnapshot.h"
 //======================================
 
 namespace Directus
@@ -44,7 +50,8 @@ namespace Directus
 	class ResourceManager;
 	class Font;
 	class Grid;
-	class Variant;	
+	class RenderGraph;
+	class TextureStreamer;
 
 	namespace Math
 	{
@@ -87,6 +94,13 @@ namespace Directus
 		void Present();
 		void Render();
 
+		//= SNAPSHOT ===========================================================================
+		// Copies the render data of the scene (transforms, materials, lights, camera) into the back snapshot
+		void Snapshot_Capture();
+		// Makes the back snapshot the one that Render() draws (if one was captured since the last swap)
+		void Snapshot_Swap();
+		//======================================================================================
+
 		// The back-buffer is the final output (should match the display size)
 		void SetBackBufferSize(int width, int height);
 		const RHI_Viewport& GetViewportBackBuffer();
@@ -108,54 +122,114 @@ namespace Directus
 		static bool RenderFlags_IsSet(RenderMode flag)				{ return m_flags & flag; }
 		//====================================================================================
 
+		//= TEXTURE STREAMING ===============================================================
+		// How much memory the streamed textures may use, 0 means unlimited
+		void TextureStreaming_SetBudget(unsigned long long bytes);
+		unsigned long long TextureStreaming_GetBudget();
+		unsigned long long TextureStreaming_GetMemory();
+		//====================================================================================
+
 		void Clear();
-		const std::vector<Actor*>& GetRenderables() { return m_renderables; }
 
 	private:
 		void RenderTargets_Create(int width, int height);
+		void RenderGraph_Declare();
+
+		void Renderables_Acquire();
 
-		void Renderables_Acquire(const Variant& renderables);
-		void Renderables_Sort(std::vector<Actor*>* renderables);
+		// Requests the mips the visible textures need, based on their size on screen, and makes the mips which loaded resident
+		void Textures_Stream();
 
-		void Pass_DepthDirectionalLight(Light* directionalLight);
+		// Records [0, count) in chunks on the worker threads and submits them in order. plan() sets the chunk's uploadSize,
+		// record() gets a block of that size (chunk.upload) and records into the chunk's command list. Returns the chunk count.
+		struct RecordChunk;
+		unsigned int Record_Parallel(unsigned int count, const std::function<void(RecordChunk&)>& plan, const std::function<void(RecordChunk&)>& record);
+
+		void Pass_DepthDirectionalLight(const RenderLight* directionalLight);
 		void Pass_GBuffer();
-		void Pass_PreLight(void* inTextureNormal, void* inTextureDepth, void* inTextureNormalNoise, void* inRenderTexure, void* outRenderTextureShadowing);
-		void Pass_Light(void* inTextureShadowing, void* outRenderTexture);	
-		void Pass_PostLight(
-			std::shared_ptr<D3D11_RenderTexture>& inRenderTexture1,
-			std::shared_ptr<D3D11_RenderTexture>& inRenderTexture2,
-			std::shared_ptr<D3D11_RenderTexture>& outRenderTexture
-		);
+		void Pass_Light(void* inTextureShadowing, void* inTextureFramePrevious, void* outRenderTexture);
 		bool Pass_DebugGBuffer();
 		void Pass_Debug();
 		void Pass_Correction(void* inTexture, void* outTexture);
 		void Pass_FXAA(void* inTexture, void* outTexture);
 		void Pass_Sharpening(void* inTexture, void* outTexture);
 		void Pass_ChromaticAberration(void* inTexture, void* outTexture);
-		void Pass_Bloom(
-			std::shared_ptr<D3D11_RenderTexture>& inRenderTexture1,
-			std::shared_ptr<D3D11_RenderTexture>& inRenderTexture2,
-			std::shared_ptr<D3D11_RenderTexture>& outRenderTexture
-		);
+		void Pass_Bloom(void* inSourceTexture, void* inTextureSpare, void* outTexture);
 		void Pass_Blur(void* texture, void* renderTarget, const Math::Vector2& blurScale);
-		void Pass_Shadowing(void* inTextureNormal, void* inTextureDepth, void* inTextureNormalNoise, Light* inDirectionalLight, void* outRenderTexture);
+		void Pass_Shadowing(void* inTextureNormal, void* inTextureDepth, void* inTextureNormalNoise, const RenderLight* inDirectionalLight, void* outRenderTexture);
 
 		const Math::Vector4& GetClearColor();
 
 		std::unique_ptr<GBuffer> m_gbuffer;
 
-		// actorS ========================
-		std::vector<Actor*> m_renderables;
+		//= ACTORS ================================================
 		std::vector<Light*> m_lights;
-		Light* m_directionalLight{};
-		//=====================================
+		std::vector<void*> m_cullVisible;	// Renderables, as returned by the spatial index
+		std::vector<void*> m_cullCasters;
+		//=========================================================
+
+		//= RENDER QUEUE KEYS ===================================================
+		// Resource ID -> compact ID, rebuilt with every snapshot
+		std::unordered_map<unsigned int, unsigned int> m_keyShaders;
+		std::unordered_map<unsigned int, unsigned int> m_keyMaterials;
+		std::unordered_map<unsigned long long, unsigned int> m_keyMeshes;
+		//=======================================================================
+
+		//= PER OBJECT DATA =====================================================
+		std::unique_ptr<RHI_UploadRing> m_uploadRing;
 
-		//= RENDER TEXTURES ======================================
-		std::shared_ptr<D3D11_RenderTexture> m_renderTexPing;
-		std::shared_ptr<D3D11_RenderTexture> m_renderTexPing2;
-		std::shared_ptr<D3D11_RenderTexture> m_renderTexShadowing;
-		std::shared_ptr<D3D11_RenderTexture> m_renderTexPong;
-		//========================================================
+		// Consecutive queue entries drawn as instances
+		struct InstanceRun
+		{
+			unsigned int entry;
+			unsigned int count;
+		};
+
+		// A range of a pass, recorded by a single thread
+		struct RecordChunk
+		{
+			unsigned int begin;
+			unsigned int end;
+			unsigned int uploadSize;
+			RHI_UploadAllocation upload;
+			std::vector<InstanceRun> runs;
+			unsigned int meshesRendered;
+			unsigned int meshesInstanced;
+			RHI_CommandList commandList;
+		};
+		std::vector<RecordChunk> m_recordChunks;
+		//=======================================================================
+
+		//= TEXTURE STREAMING ===========================================================
+		std::unique_ptr<TextureStreamer> m_textureStreamer;
+		std::unordered_map<RHI_Texture*, unsigned int> m_texturesStreamed;	// Texture -> streamer handle
+		std::vector<std::weak_ptr<RHI_Texture>> m_texturesStreamedHandles;	// Streamer handle -> texture
+
+		// Mips read by a worker, made resident by the next Textures_Stream()
+		struct StreamedMips
+		{
+			unsigned int handle;
+			unsigned int mip;
+			std::shared_ptr<RHI_Texture> texture;
+			std::shared_ptr<D3D11_Texture> shaderResource;
+		};
+		std::vector<StreamedMips> m_texturesLoaded;
+		std::mutex m_texturesLoadedMutex;
+		TaskHandle m_texturesLoadTasks;
+		//===============================================================================
+
+		//= SNAPSHOTS ================================================
+		RenderSnapshot m_snapshots[2];
+		const RenderSnapshot* m_snapshot;	// The one being rendered
+		unsigned int m_snapshotCapture;
+		unsigned int m_snapshotRender;
+		bool m_snapshotCaptured;
+		//============================================================
+
+		//= RENDER TEXTURES =====================================================================
+		std::unique_ptr<RenderGraph> m_renderGraph;
+		std::shared_ptr<D3D11_RenderTexture> m_frame; // Extracted from the graph, read back by the next frame (SSR)
+		//=======================================================================================
 
 		//= SHADERS ===========================================
 		std::unique_ptr<LightShader> m_shaderLight;
@@ -194,6 +268,7 @@ namespace Directus
 		std::unique_ptr<RHI_Texture> m_gizmoTexLightPoint;
 		std::unique_ptr<RHI_Texture> m_gizmoTexLightSpot;
 		std::unique_ptr<Rectangle> m_gizmoRectLight;
+		std::unique_ptr<LineRenderer> m_lineRenderer;
 		static unsigned long m_flags;
 		//==================================================
 
@@ -207,7 +282,6 @@ namespace Directus
 		//= PREREQUISITES ==================
 		Camera* m_camera;
 		Skybox* m_skybox;
-		LineRenderer* m_lineRenderer;
 		Math::Matrix m_mV;
 		Math::Matrix m_mP_perspective;
 		Math::Matrix m_mP_orthographic;
@@ -218,11 +292,5 @@ namespace Directus
 		float m_farPlane;
 		RHI* m_rhi;
 		//==================================
-
-		//= PIPELINE STATE ===================
-		unsigned int m_currentlyBoundGeometry;
-		unsigned int m_currentlyBoundShader;
-		unsigned int m_currentlyBoundMaterial;
-		//====================================
 	};
 }
\ No newline at end of file
@@ -0,0 +1,243 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ===============
+#include "TextureStreamer.h"
+#include <algorithm>
+#include <limits>
+#include "../Math/MathHelper.h"
+#include "../Math/BoundingBox.h"
+//==========================
+
+//= NAMESPACES ================
+using namespace std;
+using namespace Directus::Math;
+//=============================
+
+namespace Directus
+{
+	unsigned int TextureStreamer::Add(unsigned int width, unsigned int height, unsigned int mipCount, unsigned int bytesPerPixel, unsigned int mipResident)
+	{
+		unsigned int handle = (unsigned int)m_items.size();
+		if (!m_free.empty())
+		{
+			handle = m_free.back();
+			m_free.pop_back();
+		}
+		else
+		{
+			m_items.emplace_back();
+		}
+
+		Item& item			= m_items[handle];
+		item				= Item();
+		item.width			= width;
+		item.height			= height;
+		item.mipCount		= Max(mipCount, 1u);
+		item.bytesPerPixel	= bytesPerPixel;
+		item.mipTail		= ComputeMipTail(width, height, item.mipCount);
+		item.mipResident	= Min(mipResident, item.mipCount - 1);
+		item.mipTarget		= item.mipResident;
+		item.mipRequested	= item.mipTail;
+		item.alive			= true;
+		m_memory			+= GetMemory(item, item.mipResident);
+
+		return handle;
+	}
+
+	void TextureStreamer::Remove(unsigned int handle)
+	{
+		if (handle >= m_items.size() || !m_items[handle].alive)
+			return;
+
+		Item& item = m_items[handle];
+		if (item.mipTarget != item.mipResident)
+		{
+			m_inFlight--;
+		}
+		m_memory	-= GetMemory(item, item.mipTarget);
+		item.alive	= false;
+		m_free.push_back(handle);
+	}
+
+	void TextureStreamer::Request(unsigned int handle, unsigned int mip)
+	{
+		Item& item = m_items[handle];
+		if (item.frameRequested != m_frame)
+		{
+			item.frameRequested	= m_frame;
+			item.mipRequested	= item.mipTail;
+		}
+		item.mipRequested = Min(item.mipRequested, Min(mip, item.mipCount - 1));
+	}
+
+	const vector<TextureStreamer::Change>& TextureStreamer::Update()
+	{
+		m_changes.clear();
+		m_upgrades.clear();
+		m_drops.clear();
+
+		// What isn't visible can go back to its tail, but only if the memory is needed
+		auto wanted = [this](const Item& item) { return item.frameRequested == m_frame ? item.mipRequested : item.mipTail; };
+
+		for (unsigned int handle = 0; handle < (unsigned int)m_items.size(); handle++)
+		{
+			const Item& item = m_items[handle];
+			if (!item.alive || item.mipTarget != item.mipResident)
+				continue;
+
+			unsigned int mip = wanted(item);
+			if (mip < item.mipResident)
+			{
+				m_upgrades.push_back(handle);
+			}
+			else if (mip > item.mipResident)
+			{
+				m_drops.push_back(handle);
+			}
+		}
+
+		// The furthest from what they should be first, then the least recently requested are dropped first.
+		// Stable, so that ties are broken by handle and the same requests always result in the same changes.
+		stable_sort(m_upgrades.begin(), m_upgrades.end(), [this, &wanted](unsigned int a, unsigned int b)
+		{
+			return m_items[a].mipResident - wanted(m_items[a]) > m_items[b].mipResident - wanted(m_items[b]);
+		});
+		stable_sort(m_drops.begin(), m_drops.end(), [this](unsigned int a, unsigned int b)
+		{
+			return m_items[a].frameRequested < m_items[b].frameRequested;
+		});
+
+		size_t dropNext	= 0;
+		auto drop		= [this, &dropNext, &wanted]()
+		{
+			if (dropNext == m_drops.size() || m_inFlight >= TEXTURE_STREAMING_CHANGES_MAX)
+				return false;
+
+			unsigned int handle = m_drops[dropNext++];
+			Issue(handle, wanted(m_items[handle]));
+			return true;
+		};
+
+		for (unsigned int handle : m_upgrades)
+		{
+			if (m_inFlight >= TEXTURE_STREAMING_CHANGES_MAX)
+				break;
+
+			const Item& item	= m_items[handle];
+			unsigned int mip	= wanted(item);
+			if (m_budget != 0)
+			{
+				auto fits = [this, &item](unsigned int mip) { return m_memory - GetMemory(item, item.mipTarget) + GetMemory(item, mip) <= m_budget; };
+
+				// Make room, then settle for a less detailed mip if there still isn't enough of it
+				while (!fits(mip) && drop()) {}
+				while (mip < item.mipResident && !fits(mip)) { mip++; }
+				if (mip == item.mipResident)
+					continue;
+			}
+
+			Issue(handle, mip);
+		}
+
+		// Still over (e.g. the budget was lowered)
+		if (m_budget != 0)
+		{
+			while (m_memory > m_budget && drop()) {}
+		}
+
+		m_frame++;
+		return m_changes;
+	}
+
+	void TextureStreamer::SetResident(unsigned int handle, unsigned int mip)
+	{
+		if (handle >= m_items.size())
+			return;
+
+		Item& item = m_items[handle];
+		if (!item.alive || item.mipTarget == item.mipResident)
+			return;
+
+		mip					= Min(mip, item.mipCount - 1);
+		m_memory			= m_memory - GetMemory(item, item.mipTarget) + GetMemory(item, mip);
+		item.mipResident	= mip;
+		item.mipTarget		= mip;
+		m_inFlight--;
+	}
+
+	void TextureStreamer::Issue(unsigned int handle, unsigned int mip)
+	{
+		// Accounted for straight away, so that the budget holds while the change is in flight
+		Item& item		= m_items[handle];
+		m_memory		= m_memory - GetMemory(item, item.mipTarget) + GetMemory(item, mip);
+		item.mipTarget	= mip;
+		m_inFlight++;
+		m_changes.push_back({ handle, mip });
+	}
+
+	unsigned int TextureStreamer::ComputeMip(unsigned int width, unsigned int height, unsigned int mipCount, float screenSize)
+	{
+		if (mipCount == 0)
+			return 0;
+
+		float ratio = (float)Max(width, height) / Max(screenSize, 1.0f);
+		if (ratio <= 1.0f)
+			return 0;
+
+		return Min((unsigned int)log2f(ratio), mipCount - 1);
+	}
+
+	unsigned int TextureStreamer::ComputeMipTail(unsigned int width, unsigned int height, unsigned int mipCount)
+	{
+		unsigned int mip = 0;
+		while (mip + 1 < mipCount && Max(width >> mip, height >> mip) > TEXTURE_STREAMING_TAIL_SIZE)
+		{
+			mip++;
+		}
+
+		return mip;
+	}
+
+	float TextureStreamer::ComputeScreenSize(const BoundingBox& box, const Vector3& cameraPosition, float projectionScale, float viewportHeight)
+	{
+		float radius	= box.GetExtents().Length();
+		float distance	= (box.GetCenter() - cameraPosition).Length();
+
+		// The camera is inside of it
+		if (distance <= radius)
+			return numeric_limits<float>::max();
+
+		// The diameter, projected, from NDC (which spans 2) to pixels
+		return (radius / distance) * projectionScale * viewportHeight;
+	}
+
+	unsigned long long TextureStreamer::ComputeMemory(unsigned int width, unsigned int height, unsigned int mipCount, unsigned int bytesPerPixel, unsigned int mip)
+	{
+		unsigned long long size = 0;
+		for (; mip < mipCount; mip++)
+		{
+			size += (unsigned long long)Max(width >> mip, 1u) * Max(height >> mip, 1u) * bytesPerPixel;
+		}
+
+		return size;
+	}
+}
\ No newline at end of file
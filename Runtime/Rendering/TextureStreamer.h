@@ -0,0 +1,120 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==================
+#include <vector>
+#include "../Core/EngineDefs.h"
+//=============================
+
+namespace Directus
+{
+	namespace Math
+	{
+		class Vector3;
+		class BoundingBox;
+	}
+
+	// Mips which are this size (or smaller) are always resident, they are what a texture is loaded with
+	static const unsigned int TEXTURE_STREAMING_TAIL_SIZE	= 128;
+	// How many residency changes can be in flight, so that a camera cut doesn't flood the workers with reads
+	static const unsigned int TEXTURE_STREAMING_CHANGES_MAX	= 16;
+	// The renderer's default budget
+	static const unsigned long long TEXTURE_STREAMING_BUDGET	= 512ULL * 1024 * 1024;
+
+	// Decides which mips of the streamed textures should be resident. It knows nothing about files or the GPU,
+	// it's told which mip each texture is wanted at every frame and answers with residency changes. The caller
+	// carries them out and confirms them with SetResident(), so the policy can be driven headless, e.g. by a
+	// recorded camera path, and what it decides can be compared across runs.
+	class ENGINE_CLASS TextureStreamer
+	{
+	public:
+		// Make mip the most detailed resident mip of the texture
+		struct Change
+		{
+			unsigned int handle;
+			unsigned int mip;
+		};
+
+		TextureStreamer() {}
+		~TextureStreamer() {}
+
+		// Starts streaming a texture which has mipResident to mipCount - 1 resident, returns its handle
+		unsigned int Add(unsigned int width, unsigned int height, unsigned int mipCount, unsigned int bytesPerPixel, unsigned int mipResident);
+		// Stops streaming a texture (e.g. it was unloaded), a pending change of it is forgotten
+		void Remove(unsigned int handle);
+		// The texture is visible at this mip, the most detailed of the frame's requests wins
+		void Request(unsigned int handle, unsigned int mip);
+		// Ends the frame, returns the changes to carry out. Textures are upgraded, most wanted first, within the budget.
+		// To make room, textures which weren't requested at their resident mip are dropped, least recently requested first.
+		const std::vector<Change>& Update();
+		// A change was carried out (or, if it failed, mip is what is still resident)
+		void SetResident(unsigned int handle, unsigned int mip);
+
+		unsigned int GetMipResident(unsigned int handle) const { return m_items[handle].mipResident; }
+		unsigned long long GetMemoryResident() const { return m_memory; }
+		unsigned int GetCount() const { return (unsigned int)(m_items.size() - m_free.size()); }
+
+		// How much memory the streamed mips may use, the tails are always resident. 0 means unlimited.
+		void SetBudget(unsigned long long bytes)	{ m_budget = bytes; }
+		unsigned long long GetBudget() const		{ return m_budget; }
+
+		//= MIP SELECTION ====================================================================================================
+		// The most detailed mip which is still at least a texel per pixel, for a texture spanning screenSize pixels once
+		static unsigned int ComputeMip(unsigned int width, unsigned int height, unsigned int mipCount, float screenSize);
+		// The first of the mips which are always resident
+		static unsigned int ComputeMipTail(unsigned int width, unsigned int height, unsigned int mipCount);
+		// The size, in pixels, of a world space box as seen from the camera. projectionScale is the projection's m11.
+		static float ComputeScreenSize(const Math::BoundingBox& box, const Math::Vector3& cameraPosition, float projectionScale, float viewportHeight);
+		// The memory of mips [mip, mipCount)
+		static unsigned long long ComputeMemory(unsigned int width, unsigned int height, unsigned int mipCount, unsigned int bytesPerPixel, unsigned int mip);
+		//====================================================================================================================
+
+	private:
+		struct Item
+		{
+			unsigned int width			= 0;
+			unsigned int height			= 0;
+			unsigned int mipCount		= 0;
+			unsigned int bytesPerPixel	= 0;
+			unsigned int mipTail		= 0;
+			unsigned int mipResident	= 0;
+			unsigned int mipTarget		= 0;	// What is accounted for, differs from mipResident while a change is in flight
+			unsigned int mipRequested	= 0;
+			unsigned long long frameRequested = 0;
+			bool alive					= false;
+		};
+
+		unsigned long long GetMemory(const Item& item, unsigned int mip) const { return ComputeMemory(item.width, item.height, item.mipCount, item.bytesPerPixel, mip); }
+		void Issue(unsigned int handle, unsigned int mip);
+
+		std::vector<Item> m_items;
+		std::vector<unsigned int> m_free;
+		std::vector<Change> m_changes;
+		std::vector<unsigned int> m_upgrades;
+		std::vector<unsigned int> m_drops;
+		unsigned long long m_frame	= 1;
+		unsigned long long m_memory	= 0;
+		unsigned long long m_budget	= 0;
+		unsigned int m_inFlight		= 0;
+	};
+}
\ No newline at end of file
@@ -56,6 +56,34 @@ IResource::IResource(Context* context)
 	m_resourceManager	= m_context->GetSubsystem<ResourceManager>();	
 }
 
+void IResource::SetResourceName(const string& name)
+{
+	if (name == m_resourceName)
+		return;
+
+	string nameOld	= m_resourceName;
+	m_resourceName	= name;
+
+	if (m_resourceManager)
+	{
+		m_resourceManager->Reindex(this, nameOld, m_resourceFilePath);
+	}
+}
+
+void IResource::SetResourceFilePath(const string& filePath)
+{
+	if (filePath == m_resourceFilePath)
+		return;
+
+	string filePathOld	= m_resourceFilePath;
+	m_resourceFilePath	= filePath;
+
+	if (m_resourceManager)
+	{
+		m_resourceManager->Reindex(this, m_resourceName, filePathOld);
+	}
+}
+
 std::weak_ptr<IResource> IResource::_Cache()
 {
 	auto resource = m_resourceManager->GetResourceByName(GetResourceName(), m_resourceType);
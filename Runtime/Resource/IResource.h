@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES ========================
 #include <memory>
+#include <atomic>
 #include "../Core/Context.h"
 #include "../Core/GUIDGenerator.h"
 #include "../FileSystem/FileSystem.h"
@@ -79,11 +80,12 @@ namespace Directus
 
 		const char* GetResourceType_cstr() { return typeid(*this).name(); }
 
+		// Renaming (or moving) a cached resource updates the resource cache
 		const std::string& GetResourceName() { return m_resourceName; }
-		void SetResourceName(const std::string& name) { m_resourceName = name; }
+		void SetResourceName(const std::string& name);
 
 		const std::string& GetResourceFilePath() { return m_resourceFilePath; }
-		void SetResourceFilePath(const std::string& filePath) { m_resourceFilePath = filePath; }
+		void SetResourceFilePath(const std::string& filePath);
 
 		bool HasFilePath() { return m_resourceFilePath != NOT_ASSIGNED;}
 
@@ -125,7 +127,7 @@ namespace Directus
 		//= IO ================================================================
 		virtual bool SaveToFile(const std::string& filePath) { return true; }
 		virtual bool LoadFromFile(const std::string& filePath) { return true; }
-		virtual unsigned int GetMemory() { return 0; }
+		virtual unsigned long long GetMemory() { return 0; }
 		//=====================================================================
 
 		//= TYPE ================================
@@ -138,7 +140,7 @@ namespace Directus
 		//================================================
 
 		LoadState GetLoadState() { return m_loadState; }
-		void GetLoadState(LoadState state) { m_loadState = state; }
+		void SetLoadState(LoadState state) { m_loadState = state; }
 
 	protected:
 		std::weak_ptr<IResource> _Cache();
@@ -148,7 +150,7 @@ namespace Directus
 		std::string m_resourceName			= NOT_ASSIGNED;
 		std::string m_resourceFilePath		= NOT_ASSIGNED;
 		ResourceType m_resourceType			= Resource_Unknown;
-		LoadState m_loadState				= LoadState_Idle;
+		std::atomic<LoadState> m_loadState	= LoadState_Idle; // Written by whichever thread loads the resource
 		Context* m_context					= nullptr;
 		ResourceManager* m_resourceManager	= nullptr;
 	};
@@ -54,7 +54,8 @@ namespace Directus
 
 	void ImageImporter::LoadAsync(const string& filePath, RHI_Texture* texInfo)
 	{
-		m_context->GetSubsystem<Threading>()->AddTask([this, &filePath, &texInfo]()
+		// By value, the caller's arguments are long gone by the time the task runs
+		m_context->GetSubsystem<Threading>()->AddTask([this, filePath, texInfo]()
 		{
 			Load(filePath, texInfo);
 		});
@@ -254,14 +255,12 @@ namespace Directus
 		{
 			int width = 0;
 			int height = 0;
-			bool complete = false;
 			vector<std::byte> rgba;
 
-			RescaleJob(int width, int height, bool scaled)
+			RescaleJob(int width, int height)
 			{
 				this->width = width;
 				this->height = height;
-				this->complete = scaled;
 			}
 		};
 		vector<RescaleJob> rescaleJobs;
@@ -272,41 +271,30 @@ namespace Directus
 			width = max(width / 2, 1);
 			height = max(height / 2, 1);
 
-			rescaleJobs.emplace_back(width, height, false);
+			rescaleJobs.emplace_back(width, height);
 		}
 
 		// Parallelize mipmap generation using multiple
 		// threads as FreeImage_Rescale() using FILTER_LANCZOS3 can take a while.
 		Threading* threading = m_context->GetSubsystem<Threading>();
+		TaskHandle handle;
 		for (auto& job : rescaleJobs)
 		{
-			threading->AddTask([this, &job, &bitmap]()
+			threading->AddTask([this, &job, bitmap]()
 			{
 				if (!GetRescaledBitsFromBitmap(&job.rgba, job.width, job.height, bitmap))
 				{
 					string mipSize = "(" + to_string(job.width) + "x" + to_string(job.height) + ")";
 					LOG_INFO("ImageImporter: Failed to create mip level " + mipSize + ".");
 				}
-				job.complete = true;
-			});
+			}, handle);
 		}
 
-		// Wait until all mimaps have been generated
-		bool ready = false;
-		while (!ready)
-		{
-			ready = true;
-			for (const auto& job : rescaleJobs)
-			{
-				if (!job.complete)
-				{
-					ready = false;
-				}
-			}
-		}
+		// Wait until all mimaps have been generated (this thread helps out instead of spinning)
+		threading->Wait(handle);
 
 		// Now move the mip map data into the texture
-		for (const auto& job : rescaleJobs)
+		for (auto& job : rescaleJobs)
 		{
 			texture->GetRGBA().emplace_back(move(job.rgba));
 		}
@@ -317,25 +305,30 @@ namespace Directus
 		if (bitsRGBA.empty())
 			return false;
 
-		int grayPixels = 0;
-		int totalPixels = width * height;
-		int channels = 4;
+		unsigned int totalPixels	= width * height;
+		unsigned int channels		= 4;
 
-		for (int i = 0; i < height; i++)
-		{
-			for (int j = 0; j < width; j++)
+		// Count the gray pixels of each chunk in parallel and sum them up
+		unsigned int grayPixels = m_context->GetSubsystem<Threading>()->ParallelReduce(0, totalPixels, 0, 0u,
+			[&bitsRGBA, channels](unsigned int begin, unsigned int end)
 			{
-				std::byte red	= bitsRGBA[(i * width + j) * channels + 0];
-				std::byte green	= bitsRGBA[(i * width + j) * channels + 1];
-				std::byte blue	= bitsRGBA[(i * width + j) * channels + 2];
-
-				if (red == green && red == blue)
+				unsigned int count = 0;
+				for (unsigned int i = begin; i < end; i++)
 				{
-					grayPixels++;
+					std::byte red	= bitsRGBA[i * channels + 0];
+					std::byte green	= bitsRGBA[i * channels + 1];
+					std::byte blue	= bitsRGBA[i * channels + 2];
+
+					if (red == green && red == blue)
+					{
+						count++;
+					}
 				}
-			}
-		}
+				return count;
+			},
+			[](unsigned int a, unsigned int b) { return a + b; }
+		);
 
 		return grayPixels == totalPixels;
 	}
-}
+}
\ No newline at end of file
@@ -78,6 +78,7 @@ namespace Directus
 		ImageImporter(Context* context);
 		~ImageImporter();
 
+		// The texture has to outlive the load
 		void LoadAsync(const std::string& filePath, RHI_Texture* texInfo);
 		bool Load(const std::string& filePath, RHI_Texture* texInfo);
 		bool RescaleBits(std::vector<std::byte>* rgba, unsigned int fromWidth, unsigned int fromHeight, unsigned int toWidth, unsigned int toHeight);
@@ -43,6 +43,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../ProgressReport.h"
 #include "../../RHI/RHI_Device.h"
 #include "../../RHI/RHI_Texture.h"
+#include "../../Threading/Threading.h"
 //============================================
 
 //= NAMESPACES ================
@@ -286,6 +287,12 @@ namespace Directus
 		unsigned int vertexOffset;
 		model->Geometry_Append(indices, vertices, &indexOffset, &vertexOffset);
 
+		// Compute the bounding box (in parallel, large meshes can have millions of vertices)
+		BoundingBox aabb = m_context->GetSubsystem<Threading>()->ParallelReduce(0, (unsigned int)vertices.size(), 0, BoundingBox(),
+			[&vertices](unsigned int begin, unsigned int end) { return BoundingBox(&vertices[begin], end - begin); },
+			[](BoundingBox a, const BoundingBox& b) { a.Merge(b); return a; }
+		);
+
 		// Add a renderable component to this Actor
 		auto actorShared	= parentActor.lock();
 		auto renderable			= actorShared->AddComponent<Renderable>().lock();
@@ -297,7 +304,7 @@ namespace Directus
 			(unsigned int)indices.size(),
 			vertexOffset,
 			(unsigned int)vertices.size(),
-			BoundingBox(vertices),
+			aabb,
 			model
 		);
 		//=============================================================================
@@ -323,16 +330,17 @@ namespace Directus
 
 	void ModelImporter::AssimpMesh_ExtractVertices(aiMesh* assimpMesh, vector<RHI_Vertex_PosUVTBN>* vertices)
 	{
-		Vector3 position;
-		Vector2 uv;
-		Vector3 normal;
-		Vector3 tangent;
-		Vector3 bitangent;
-
-		vertices->reserve(assimpMesh->mNumVertices);
+		vertices->resize(assimpMesh->mNumVertices);
 
-		for (unsigned int vertexIndex = 0; vertexIndex < assimpMesh->mNumVertices; vertexIndex++)
+		// Every vertex is independent, so they can be converted in parallel
+		m_context->GetSubsystem<Threading>()->ParallelFor(0, assimpMesh->mNumVertices, 0, [assimpMesh, vertices](unsigned int vertexIndex)
 		{
+			Vector3 position;
+			Vector2 uv;
+			Vector3 normal;
+			Vector3 tangent;
+			Vector3 bitangent;
+
 			// Position
 			position = AssimpHelper::ToVector3(assimpMesh->mVertices[vertexIndex]);
 
@@ -361,18 +369,27 @@ namespace Directus
 			}
 
 			// save the vertex
-			vertices->emplace_back(position, uv, normal, tangent, bitangent);
-
-			// reset the vertex for use in the next loop
-			uv			= Vector2::Zero;
-			normal		= Vector3::Zero;
-			tangent		= Vector3::Zero;
-			bitangent	= Vector3::Zero;
-		}
+			(*vertices)[vertexIndex] = RHI_Vertex_PosUVTBN(position, uv, normal, tangent, bitangent);
+		});
 	}
 
 	void ModelImporter::AssimpMesh_ExtractIndices(aiMesh* assimpMesh, vector<unsigned int>* indices)
 	{
+		// If the mesh consists only of triangles (the usual case, as we triangulate), 
+		// the location of each face's indices is known, so faces can be copied in parallel.
+		if (assimpMesh->mPrimitiveTypes == aiPrimitiveType_TRIANGLE)
+		{
+			indices->resize(assimpMesh->mNumFaces * 3);
+			m_context->GetSubsystem<Threading>()->ParallelFor(0, assimpMesh->mNumFaces, 0, [assimpMesh, indices](unsigned int faceIndex)
+			{
+				const aiFace& face = assimpMesh->mFaces[faceIndex];
+				(*indices)[faceIndex * 3 + 0] = face.mIndices[0];
+				(*indices)[faceIndex * 3 + 1] = face.mIndices[1];
+				(*indices)[faceIndex * 3 + 2] = face.mIndices[2];
+			});
+			return;
+		}
+
 		// Get indices by iterating through each face of the mesh.
 		for (unsigned int faceIndex = 0; faceIndex < assimpMesh->mNumFaces; faceIndex++)
 		{
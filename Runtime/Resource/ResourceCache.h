@@ -24,63 +24,129 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ==============
 #include <vector>
 #include <memory>
+#include <map>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 #include "IResource.h"
 #include "../Logging/Log.h"
-#include <mutex>
 //========================
 
 namespace Directus
 {
+	// Resources are indexed by a hash of their type and name (and of their type and path), the indices are split into
+	// shards with a lock each, so that lookups from different threads (e.g. textures loaded by Threading tasks) rarely
+	// wait on each other. A hit is confirmed against the resource's actual name/path, so collisions are harmless.
+	// Each type can be given a memory budget, when exceeded, Evict() unloads the least recently used resources which
+	// nothing outside of the cache references (they are simply reloaded the next time they are requested).
+	static const unsigned int RESOURCE_CACHE_SHARDS = 16;
+
 	class ENGINE_CLASS ResourceCache
 	{
 	public:
 		ResourceCache() {}
 		~ResourceCache() { Clear(); }
 
-		// Adds a resource
-		void Add(const std::shared_ptr<IResource>& resource)
+		// Adds a resource, unless one of the same type and name is already cached, in which case that one is returned.
+		// Resources without a name are always added.
+		std::shared_ptr<IResource> Add(const std::shared_ptr<IResource>& resource)
+		{
+			if (!resource)
+				return resource;
+
+			ResourceType type		= resource->GetResourceType();
+			std::string name		= resource->GetResourceName();
+			std::string path		= resource->GetResourceFilePath();
+			size_t keyName			= GetKey(name, type);
+
+			// Looked up and inserted under the same lock, so that two threads can't cache the same resource.
+			// The other locks are taken while holding it (always in this order), so a resource which can be
+			// found by name can also be found by path and enumerated.
+			Shard& shardName = GetShard(m_shardsName, keyName);
+			std::unique_lock<std::shared_mutex> lockName(shardName.mutex);
+			if (name != NOT_ASSIGNED)
+			{
+				if (auto cached = Find(shardName.index, keyName, name, type, &IResource::GetResourceName))
+					return cached;
+			}
+
+			auto entry		= std::make_shared<Entry>();
+			entry->resource	= resource;
+			entry->memory	= resource->GetMemory();
+			entry->lastUsed	= m_clock++;
+			shardName.index.emplace(keyName, entry);
+
+			Index(m_shardsPath, GetKey(path, type), entry);
+
+			std::unique_lock<std::shared_mutex> lock(m_mutex);
+			Group& group = m_resourceGroups[type];
+			group.entries.push_back(entry);
+			group.memory += entry->memory;
+
+			return resource;
+		}
+
+		// Updates the indices of a cached resource after its name or path changed (does nothing if it isn't cached)
+		void Reindex(IResource* resource, const std::string& nameOld, const std::string& pathOld)
 		{
 			if (!resource)
 				return;
 
-			std::lock_guard<std::mutex> guard(m_mutex);
-			m_resourceGroups[resource->GetResourceType()].push_back(resource);
+			ResourceType type = resource->GetResourceType();
+			if (nameOld != resource->GetResourceName())
+			{
+				if (auto shared = Unindex(m_shardsName, GetKey(nameOld, type), resource))
+				{
+					Index(m_shardsName, GetKey(resource->GetResourceName(), type), shared);
+				}
+			}
+
+			if (pathOld != resource->GetResourceFilePath())
+			{
+				if (auto shared = Unindex(m_shardsPath, GetKey(pathOld, type), resource))
+				{
+					Index(m_shardsPath, GetKey(resource->GetResourceFilePath(), type), shared);
+				}
+			}
 		}
 
 		// Returns the file paths of all the resources
 		void GetResourceFilePaths(std::vector<std::string>& filePaths)
 		{
-			for (const auto& resourceGroup : m_resourceGroups)
+			for (const auto& resource : GetAll())
 			{
-				for (const auto& resource : resourceGroup.second)
-				{
-					filePaths.push_back(resource->GetResourceFilePath());
-				}
+				filePaths.push_back(resource->GetResourceFilePath());
 			}
 		}
 
 		// Makes the resources save their metadata
 		void SaveResourcesToFiles()
 		{
-			for (const auto& resourceGroup : m_resourceGroups)
+			// A copy, saving might change a resource's path (and with it the indices)
+			for (const auto& resource : GetAll())
 			{
-				for (const auto& resource : resourceGroup.second)
-				{
-					if (!resource->HasFilePath())
-						continue;
+				if (!resource->HasFilePath())
+					continue;
 
-					resource->SaveToFile(resource->GetResourceFilePath());
-				}
+				resource->SaveToFile(resource->GetResourceFilePath());
 			}
 		}
 
 		// Returns all the resources
 		std::vector<std::shared_ptr<IResource>> GetAll()
 		{
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+
 			std::vector<std::shared_ptr<IResource>> resources;
 			for (const auto& resourceGroup : m_resourceGroups)
 			{
-				resources.insert(resources.end(), resourceGroup.second.begin(), resourceGroup.second.end());
+				for (const auto& entry : resourceGroup.second.entries)
+				{
+					resources.push_back(entry->resource);
+				}
 			}
 
 			return resources;
@@ -90,38 +156,27 @@ namespace Directus
 		template <class T>
 		std::shared_ptr<IResource> GetByName(const std::string& name)
 		{
-			for (const auto& resource : m_resourceGroups[IResource::DeduceResourceType<T>()])
-			{
-				if (name == resource->GetResourceName())
-					return resource;
-			}
-
-			return std::shared_ptr<IResource>();
+			return GetByName(name, IResource::DeduceResourceType<T>());
 		}
 
 		// Returns a resource by name
 		std::shared_ptr<IResource> GetByName(const std::string& name, ResourceType type)
 		{
-			for (const auto& resource : m_resourceGroups[type])
-			{
-				if (name == resource->GetResourceName())
-					return resource;
-			}
-
-			return std::shared_ptr<IResource>();
+			size_t key		= GetKey(name, type);
+			Shard& shard	= GetShard(m_shardsName, key);
+			std::shared_lock<std::shared_mutex> lock(shard.mutex);
+			return Find(shard.index, key, name, type, &IResource::GetResourceName);
 		}
 
 		// Returns a resource by path
 		template <class T>
 		std::shared_ptr<IResource> GetByPath(const std::string& path)
 		{
-			for (const auto& resource : m_resourceGroups[IResource::DeduceResourceType<T>()])
-			{
-				if (path == resource->GetResourceFilePath())
-					return resource;
-			}
-
-			return std::shared_ptr<IResource>();
+			ResourceType type	= IResource::DeduceResourceType<T>();
+			size_t key			= GetKey(path, type);
+			Shard& shard		= GetShard(m_shardsPath, key);
+			std::shared_lock<std::shared_mutex> lock(shard.mutex);
+			return Find(shard.index, key, path, type, &IResource::GetResourceFilePath);
 		}
 
 		// Checks whether a resource is already cached
@@ -139,51 +194,304 @@ namespace Directus
 				return false;
 			}
 
-			for (const auto& resource : m_resourceGroups[resourceType])
+			return GetByName(resourceName, resourceType) != nullptr;
+		}
+
+		//= MEMORY ===========================================================================================
+		// The memory of each resource is accounted for when it's added and whenever UpdateMemory() is called,
+		// so these don't have to walk the resources.
+		unsigned long long GetMemoryUsage()
+		{
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+			unsigned long long size = 0;
+			for (const auto& group : m_resourceGroups)
 			{
-				if (resourceName == resource->GetResourceName())
-					return true;
+				size += group.second.memory;
 			}
 
-			return false;
+			return size;
 		}
 
-		unsigned int GetMemoryUsage()
+		unsigned long long GetMemoryUsage(ResourceType type)
 		{
-			unsigned int size = 0;
-			for (const auto& group : m_resourceGroups)
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+			auto it = m_resourceGroups.find(type);
+			return it != m_resourceGroups.end() ? it->second.memory : 0;
+		}
+
+		// Re-accounts the memory of a cached resource, call it after the resource has loaded (or otherwise changed size)
+		void UpdateMemory(IResource* resource)
+		{
+			if (!resource)
+				return;
+
+			unsigned long long memory = resource->GetMemory();
+
+			std::unique_lock<std::shared_mutex> lock(m_mutex);
+			auto it = m_resourceGroups.find(resource->GetResourceType());
+			if (it == m_resourceGroups.end())
+				return;
+
+			// Searched from the back, the resources which just loaded are usually the most recently added ones
+			Group& group = it->second;
+			for (auto entry = group.entries.rbegin(); entry != group.entries.rend(); ++entry)
+			{
+				if ((*entry)->resource.get() != resource)
+					continue;
+
+				group.memory	= group.memory - (*entry)->memory + memory;
+				(*entry)->memory	= memory;
+				return;
+			}
+		}
+
+		// Sets how much memory resources of a given type may use before Evict() starts unloading them, 0 means unlimited
+		void SetMemoryBudget(ResourceType type, unsigned long long bytes)
+		{
+			std::unique_lock<std::shared_mutex> lock(m_mutex);
+			m_resourceGroups[type].budget = bytes;
+		}
+
+		unsigned long long GetMemoryBudget(ResourceType type)
+		{
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+			auto it = m_resourceGroups.find(type);
+			return it != m_resourceGroups.end() ? it->second.budget : 0;
+		}
+
+		// Unloads the least recently used resources of each type which is over its budget, until it's back within it.
+		// Only resources which are referenced by nothing but the cache (and which aren't loading) are unloaded.
+		// Returns how many resources were unloaded.
+		unsigned int Evict()
+		{
+			std::lock_guard<std::mutex> lockEvict(m_evictMutex);
+
+			// Released outside of the locks, a resource's destructor might use the cache
+			std::vector<std::shared_ptr<IResource>> evicted;
+
+			// Candidates, collected per type which is over its budget
+			std::vector<std::pair<ResourceType, unsigned long long>> overBudget;
+			{
+				std::shared_lock<std::shared_mutex> lock(m_mutex);
+				for (const auto& group : m_resourceGroups)
+				{
+					if (group.second.budget != 0 && group.second.memory > group.second.budget)
+					{
+						overBudget.emplace_back(group.first, group.second.memory - group.second.budget);
+					}
+				}
+			}
+
+			for (const auto& type : overBudget)
 			{
-				for (const auto& resource : group.second)
+				std::vector<std::pair<unsigned long long, std::shared_ptr<Entry>>> candidates;
 				{
-					if (!resource)
-						continue;
+					std::shared_lock<std::shared_mutex> lock(m_mutex);
+					for (const auto& entry : m_resourceGroups[type.first].entries)
+					{
+						if (entry->resource.use_count() != 1 || entry->resource->GetLoadState() == LoadState_Started)
+							continue;
 
-					size += resource->GetMemory();
+						candidates.emplace_back(entry->lastUsed.load(), entry);
+					}
+				}
+
+				// Least recently used first
+				std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+				unsigned long long freed = 0;
+				for (const auto& candidate : candidates)
+				{
+					if (freed >= type.second)
+						break;
+
+					unsigned long long memory = 0;
+					if (auto resource = Remove(candidate.second, memory))
+					{
+						evicted.emplace_back(std::move(resource));
+						freed += memory;
+					}
 				}
 			}
 
-			return size;
+			return (unsigned int)evicted.size();
 		}
+		//====================================================================================================
 
-		unsigned int GetMemoryUsage(ResourceType type)
+		// Returns all resources of a given type
+		std::vector<std::shared_ptr<IResource>> GetByType(ResourceType type)
 		{
-			unsigned int size = 0;
-			for (const auto& resource : m_resourceGroups[type])
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+			std::vector<std::shared_ptr<IResource>> resources;
+			auto it = m_resourceGroups.find(type);
+			if (it != m_resourceGroups.end())
 			{
-				size += resource->GetMemory();
+				for (const auto& entry : it->second.entries)
+				{
+					resources.push_back(entry->resource);
+				}
 			}
 
-			return size;
+			return resources;
 		}
 
-		// Returns all resources of a given type
-		const std::vector<std::shared_ptr<IResource>>& GetByType(ResourceType type) { return m_resourceGroups[type]; }
+		// Returns how many resources of a given type there are
+		unsigned int GetCountByType(ResourceType type)
+		{
+			std::shared_lock<std::shared_mutex> lock(m_mutex);
+			auto it = m_resourceGroups.find(type);
+			return it != m_resourceGroups.end() ? (unsigned int)it->second.entries.size() : 0;
+		}
 
 		// Unloads all resources
-		void Clear() { m_resourceGroups.clear(); }
+		void Clear()
+		{
+			// Released outside of the locks, a resource's destructor might use the cache
+			std::vector<Index_Map> indices;
+			for (auto* shards : { m_shardsName, m_shardsPath })
+			{
+				for (unsigned int i = 0; i < RESOURCE_CACHE_SHARDS; i++)
+				{
+					std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+					indices.emplace_back(std::move(shards[i].index));
+					shards[i].index.clear();
+				}
+			}
+
+			std::vector<std::shared_ptr<Entry>> entries;
+			{
+				std::unique_lock<std::shared_mutex> lock(m_mutex);
+				for (auto& group : m_resourceGroups)
+				{
+					entries.insert(entries.end(), group.second.entries.begin(), group.second.entries.end());
+					group.second.entries.clear();
+					group.second.memory = 0; // Budgets are kept
+				}
+			}
+		}
 
 	private:
-		std::map<ResourceType, std::vector<std::shared_ptr<IResource>>> m_resourceGroups;
-		std::mutex m_mutex;
+		// The cache's reference to a resource, when it's the only one (use_count() == 1) the resource can be evicted
+		struct Entry
+		{
+			std::shared_ptr<IResource> resource;
+			std::atomic<unsigned long long> lastUsed{ 0 };
+			unsigned long long memory = 0; // Guarded by m_mutex
+		};
+
+		struct Group
+		{
+			std::vector<std::shared_ptr<Entry>> entries;
+			unsigned long long memory = 0;
+			unsigned long long budget = 0;
+		};
+
+		typedef std::unordered_multimap<size_t, std::shared_ptr<Entry>> Index_Map;
+		struct Shard
+		{
+			std::shared_mutex mutex;
+			Index_Map index;
+		};
+
+		static size_t GetKey(const std::string& string, ResourceType type)
+		{
+			return std::hash<std::string>()(string) ^ (size_t(type) * 0x9E3779B97F4A7C15ULL);
+		}
+
+		static Shard& GetShard(Shard* shards, size_t key) { return shards[(key >> 4) % RESOURCE_CACHE_SHARDS]; }
+
+		// The shard has to be locked, a hit counts as a use of the resource
+		std::shared_ptr<IResource> Find(const Index_Map& index, size_t key, const std::string& string, ResourceType type, const std::string& (IResource::*getString)())
+		{
+			auto range = index.equal_range(key);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				IResource* resource = it->second->resource.get();
+				if (resource->GetResourceType() == type && (resource->*getString)() == string)
+				{
+					it->second->lastUsed = m_clock++;
+					return it->second->resource;
+				}
+			}
+
+			return std::shared_ptr<IResource>();
+		}
+
+		static void Index(Shard* shards, size_t key, const std::shared_ptr<Entry>& entry)
+		{
+			Shard& shard = GetShard(shards, key);
+			std::unique_lock<std::shared_mutex> lock(shard.mutex);
+			shard.index.emplace(key, entry);
+		}
+
+		static std::shared_ptr<Entry> Unindex(Shard* shards, size_t key, IResource* resource)
+		{
+			Shard& shard = GetShard(shards, key);
+			std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+			auto range = shard.index.equal_range(key);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				if (it->second->resource.get() == resource)
+				{
+					auto shared = it->second;
+					shard.index.erase(it);
+					return shared;
+				}
+			}
+
+			return std::shared_ptr<Entry>();
+		}
+
+		// The shard has to be locked
+		static Index_Map::iterator FindEntry(Index_Map& index, size_t key, const std::shared_ptr<Entry>& entry)
+		{
+			auto range = index.equal_range(key);
+			auto it = std::find_if(range.first, range.second, [&entry](const auto& pair) { return pair.second == entry; });
+			return it != range.second ? it : index.end();
+		}
+
+		// Removes an entry, unless its resource got referenced in the meantime. Every reference handed out by the
+		// cache is copied under one of these locks, so with all of them held, the reference count can be trusted.
+		std::shared_ptr<IResource> Remove(const std::shared_ptr<Entry>& entry, unsigned long long& memory)
+		{
+			IResource* resource	= entry->resource.get();
+			ResourceType type	= resource->GetResourceType();
+			size_t keyName		= GetKey(resource->GetResourceName(), type);
+			size_t keyPath		= GetKey(resource->GetResourceFilePath(), type);
+
+			Shard& shardName = GetShard(m_shardsName, keyName);
+			Shard& shardPath = GetShard(m_shardsPath, keyPath);
+			std::unique_lock<std::shared_mutex> lockName(shardName.mutex);
+			std::unique_lock<std::shared_mutex> lockPath(shardPath.mutex);
+			std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+			if (entry->resource.use_count() != 1)
+				return std::shared_ptr<IResource>();
+
+			// Being reindexed by another thread, try again on the next eviction
+			auto itName = FindEntry(shardName.index, keyName, entry);
+			auto itPath = FindEntry(shardPath.index, keyPath, entry);
+			if (itName == shardName.index.end() || itPath == shardPath.index.end())
+				return std::shared_ptr<IResource>();
+			shardName.index.erase(itName);
+			shardPath.index.erase(itPath);
+
+			Group& group = m_resourceGroups[type];
+			group.entries.erase(std::remove(group.entries.begin(), group.entries.end(), entry), group.entries.end());
+			group.memory	-= entry->memory;
+			memory			= entry->memory;
+
+			return std::move(entry->resource);
+		}
+
+		Shard m_shardsName[RESOURCE_CACHE_SHARDS];
+		Shard m_shardsPath[RESOURCE_CACHE_SHARDS];
+		std::map<ResourceType, Group> m_resourceGroups;
+		std::shared_mutex m_mutex; // Guards m_resourceGroups
+		std::atomic<unsigned long long> m_clock{ 0 };
+		std::mutex m_evictMutex;
 	};
 }
\ No newline at end of file
@@ -38,6 +38,44 @@ namespace Directus
 		SUBSCRIBE_TO_EVENT(EVENT_SCENE_CLEARED, EVENT_HANDLER(Clear));
 	}
 
+	ResourceManager::~ResourceManager()
+	{
+		// The loads use the cache (and the other subsystems), let them finish
+		m_context->GetSubsystem<Threading>()->Wait(m_loadTasks);
+		Clear();
+	}
+
+	void ResourceManager::Update()
+	{
+		vector<function<void()>> completed;
+		{
+			lock_guard<mutex> lock(m_loadsMutex);
+			completed.swap(m_loadsCompleted);
+		}
+
+		for (const auto& onCompleted : completed)
+		{
+			onCompleted();
+		}
+
+		// After the callbacks, they might have started referencing some of the resources
+		if (unsigned int evicted = m_resourceCache->Evict())
+		{
+			LOGF_INFO("ResourceManager::Update: Unloaded %d resources to stay within the memory budget", evicted);
+		}
+	}
+
+	void ResourceManager::SetMemoryBudget(ResourceType type, unsigned long long bytes)
+	{
+		if (type != Resource_Texture && type != Resource_Material)
+		{
+			LOG_WARNING("ResourceManager::SetMemoryBudget: Only textures and materials can be given a memory budget.");
+			return;
+		}
+
+		m_resourceCache->SetMemoryBudget(type, bytes);
+	}
+
 	bool ResourceManager::Initialize()
 	{
 		// Cache
@@ -94,4 +132,62 @@ namespace Directus
 	{
 		return FileSystem::GetWorkingDirectory() + m_projectDirectory;
 	}
-}
+
+	void ResourceManager::LoadAsync_Request(const shared_ptr<IResource>& resource, bool load, function<void()>&& onCompleted)
+	{
+		{
+			lock_guard<mutex> lock(m_loadsMutex);
+
+			// The resource is loaded already, complete on the next update
+			auto it = m_loadsPending.find(resource.get());
+			if (!load && it == m_loadsPending.end() && resource->GetLoadState() != LoadState_Started)
+			{
+				if (onCompleted)
+				{
+					m_loadsCompleted.emplace_back(move(onCompleted));
+				}
+				return;
+			}
+
+			// Wait for whoever is loading it
+			auto& callbacks = it != m_loadsPending.end() ? it->second : m_loadsPending[resource.get()];
+			if (onCompleted)
+			{
+				callbacks.emplace_back(move(onCompleted));
+			}
+		}
+
+		if (!load)
+			return;
+
+		m_context->GetSubsystem<Threading>()->AddTask([this, resource]()
+		{
+			bool loaded = resource->LoadFromFile(resource->GetResourceFilePath());
+			if (!loaded)
+			{
+				LOGF_WARNING("ResourceManager::LoadAsync: Resource \"%s\" failed to load", resource->GetResourceFilePath().c_str());
+			}
+
+			resource->SetLoadState(loaded ? LoadState_Completed : LoadState_Failed);
+			LoadAsync_Complete(resource.get());
+		}, m_loadTasks);
+	}
+
+	void ResourceManager::LoadAsync_Complete(IResource* resource)
+	{
+		// The resource has its actual size now
+		m_resourceCache->UpdateMemory(resource);
+
+		lock_guard<mutex> lock(m_loadsMutex);
+
+		auto it = m_loadsPending.find(resource);
+		if (it == m_loadsPending.end())
+			return;
+
+		for (auto& onCompleted : it->second)
+		{
+			m_loadsCompleted.emplace_back(move(onCompleted));
+		}
+		m_loadsPending.erase(it);
+	}
+}
\ No newline at end of file
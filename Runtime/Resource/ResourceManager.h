@@ -24,6 +24,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES =====================
 #include <memory>
 #include <map>
+#include <mutex>
+#include <functional>
+#include <unordered_map>
 #include "ResourceCache.h"
 #include "Import/ModelImporter.h"
 #include "Import/ImageImporter.h"
@@ -33,6 +36,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Rendering/Model.h"
 #include "../Rendering/Material.h"
 #include "../RHI/RHI_Texture.h"
+#include "../Threading/Threading.h"
 //================================
 
 namespace Directus
@@ -41,7 +45,7 @@ namespace Directus
 	{
 	public:
 		ResourceManager(Context* context);
-		~ResourceManager() { Clear(); }
+		~ResourceManager();
 
 		//= Subsystem =============
 		bool Initialize() override;
@@ -65,9 +69,9 @@ namespace Directus
 			std::string name				= FileSystem::GetFileNameNoExtensionFromFilePath(filePathRelative);
 
 			// Check if the resource is already loaded
-			if (m_resourceCache->IsCached(name, IResource::DeduceResourceType<T>()))
+			if (auto cached = m_resourceCache->GetByName<T>(name))
 			{
-				return GetResourceByName<T>(name);
+				return ToDerivedWeak<T>(cached);
 			}
 
 			// Create new resource
@@ -76,11 +80,18 @@ namespace Directus
 			typed->SetResourceName(name);
 			typed->SetResourceFilePath(filePathRelative);
 
-			// Cache it now so LoadFromFile() can safely pass around a reference to the resource from the ResourceManager
-			Add<T>(typed);
+			// Cache it now so LoadFromFile() can safely pass around a reference to the resource from the ResourceManager.
+			// If another thread got to cache it first, that one is returned instead.
+			auto cached = m_resourceCache->Add(typed);
+			if (cached != typed)
+			{
+				return ToDerivedWeak<T>(cached);
+			}
 
 			// Load
-			if (!typed->LoadFromFile(filePathRelative))
+			bool loaded = typed->LoadFromFile(filePathRelative);
+			LoadAsync_Complete(typed.get());
+			if (!loaded)
 			{
 				LOGF_WARNING("ResourceManager::Load: Resource \"%s\" failed to load", filePathRelative.c_str());
 				return std::weak_ptr<T>();
@@ -90,33 +101,93 @@ namespace Directus
 			return typed;
 		}
 
-		// Adds a resource into the cache and returns the derived resource as a weak reference
+		// Loads a resource on a worker thread. The resource is cached (as LoadState_Started) and returned straight away,
+		// so it can be used as a placeholder until it has loaded. Requesting a resource which is already cached (or loading)
+		// returns that one, concurrent requests share a single load. onCompleted is invoked on the main thread, by Update(),
+		// once the resource has completed (or failed). Note: T::LoadFromFile() runs on a worker, it must not modify the scene.
 		template <class T>
-		std::weak_ptr<T> Add(std::shared_ptr<IResource> resource)
+		std::weak_ptr<T> LoadAsync(const std::string& filePath, std::function<void(std::weak_ptr<T>)>&& onCompleted = nullptr)
 		{
-			if (!resource)
+			if (filePath == NOT_ASSIGNED)
+			{
+				LOGF_WARNING("ResourceManager::LoadAsync: Can't load resource of type \"%s\", filepath \"%s\" is unassigned.", typeid(T).name(), filePath.c_str());
 				return std::weak_ptr<T>();
+			}
+
+			// Try to make the path relative to the engine (in case it isn't)
+			std::string filePathRelative	= FileSystem::GetRelativeFilePath(filePath);
+			std::string name				= FileSystem::GetFileNameNoExtensionFromFilePath(filePathRelative);
+
+			// Create and cache a new resource, unless it's already cached (or another thread got to cache it first)
+			auto resource	= m_resourceCache->GetByName<T>(name);
+			bool load		= false;
+			if (!resource)
+			{
+				auto typed = std::make_shared<T>(m_context);
+				typed->SetResourceName(name);
+				typed->SetResourceFilePath(filePathRelative);
+				typed->SetLoadState(LoadState_Started);
 
-			// If the resource is already loaded, return the existing one
-			if (m_resourceCache->IsCached(resource))
+				resource	= m_resourceCache->Add(typed);
+				load		= resource == typed;
+			}
+
+			std::function<void()> callback;
+			if (onCompleted)
 			{
-				return GetResourceByName<T>(FileSystem::GetFileNameNoExtensionFromFilePath(resource->GetResourceFilePath()));
+				callback = [resource, onCompleted]() { onCompleted(ToDerivedWeak<T>(resource)); };
 			}
+			LoadAsync_Request(resource, load, std::move(callback));
 
-			Add(resource);
 			return ToDerivedWeak<T>(resource);
 		}
 
+		// The tasks of the asynchronous loads, a thread which waits for loads can help with them via Threading::ExecuteOne()
+		const TaskHandle& GetLoadTasks() { return m_loadTasks; }
+
+		// Invokes the completion callbacks of the asynchronous loads which have completed and unloads the resources
+		// which are over their memory budget, has to be called on the main thread
+		void Update();
+
+		// Adds a resource into the cache and returns the derived resource as a weak reference
+		template <class T>
+		std::weak_ptr<T> Add(std::shared_ptr<IResource> resource)
+		{
+			if (!resource)
+				return std::weak_ptr<T>();
+
+			// If the resource is already loaded, the existing one is returned
+			return ToDerivedWeak<T>(m_resourceCache->Add(resource));
+		}
+
 		// Adds a resource into the cache (if it's not already cached)
 		void Add(std::shared_ptr<IResource> resource)
 		{
-			if (!resource || m_resourceCache->IsCached(resource))
+			if (!resource)
 				return;
 
 			// Add the resource
 			m_resourceCache->Add(resource);
 		}
 
+		// Re-accounts the memory of a cached resource, e.g. after mips of a texture were streamed in or out
+		void UpdateMemory(IResource* resource)
+		{
+			if (!m_resourceCache)
+				return;
+
+			m_resourceCache->UpdateMemory(resource);
+		}
+
+		// Keeps the cache's name/path lookups valid, called by a resource when its name or path changes
+		void Reindex(IResource* resource, const std::string& nameOld, const std::string& pathOld)
+		{
+			if (!m_resourceCache)
+				return;
+
+			m_resourceCache->Reindex(resource, nameOld, pathOld);
+		}
+
 		// Returns cached resource by name
 		template <class T>
 		std::weak_ptr<T> GetResourceByName(const std::string& name)
@@ -174,7 +245,7 @@ namespace Directus
 		// Returns all resources of a given type
 		unsigned int GetResourceCountByType(ResourceType type)
 		{
-			return (unsigned int)m_resourceCache->GetByType(type).size();
+			return m_resourceCache->GetCountByType(type);
 		}
 
 		auto GetResourceAll() 
@@ -193,8 +264,13 @@ namespace Directus
 		}
 
 		// Memory
-		unsigned int GetMemoryUsage(ResourceType type)	{ return m_resourceCache->GetMemoryUsage(type); }
-		unsigned int GetMemoryUsage()					{ return m_resourceCache->GetMemoryUsage(); }
+		unsigned long long GetMemoryUsage(ResourceType type)	{ return m_resourceCache->GetMemoryUsage(type); }
+		unsigned long long GetMemoryUsage()						{ return m_resourceCache->GetMemoryUsage(); }
+		unsigned long long GetMemoryBudget(ResourceType type)	{ return m_resourceCache->GetMemoryBudget(type); }
+		// Once resources of the given type use more memory than this, Update() unloads the least recently used ones which
+		// are no longer referenced outside of the cache, 0 means unlimited (the default). Only textures and materials can be
+		// budgeted, other resources are held by raw or weak references which wouldn't keep them from being unloaded.
+		void SetMemoryBudget(ResourceType type, unsigned long long bytes);
 
 		// Directories
 		void AddStandardResourceDirectory(ResourceType type, const std::string& directory);
@@ -219,6 +295,18 @@ namespace Directus
 		std::shared_ptr<ImageImporter> m_imageImporter;
 		std::shared_ptr<FontImporter> m_fontImporter;
 
+		//= ASYNC LOADING =================================================================================
+		// Starts loading the resource (if load is true) or waits for it to be loaded by whoever is loading it
+		void LoadAsync_Request(const std::shared_ptr<IResource>& resource, bool load, std::function<void()>&& onCompleted);
+		// Hands the callbacks that wait on the resource over to Update()
+		void LoadAsync_Complete(IResource* resource);
+
+		std::unordered_map<IResource*, std::vector<std::function<void()>>> m_loadsPending;
+		std::vector<std::function<void()>> m_loadsCompleted;
+		std::mutex m_loadsMutex;
+		TaskHandle m_loadTasks;
+		//=================================================================================================
+
 		// Derived -> Base (as a shared pointer)
 		template <class Type>
 		static std::shared_ptr<IResource> ToBaseShared(std::shared_ptr<Type> derived)
@@ -0,0 +1,588 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ================
+#include "AABBTree.h"
+#include "../Math/Frustum.h"
+#include "../Math/Ray.h"
+//===========================
+
+//= NAMESPACES ================
+using namespace std;
+using namespace Directus::Math;
+//=============================
+
+// How much a proxy's box is enlarged by, so that it can move a bit without the tree having to change
+static const float FAT_MARGIN = 0.1f;
+
+namespace Directus
+{
+	namespace
+	{
+		inline BoundingBox Merged(const BoundingBox& a, const BoundingBox& b)
+		{
+			BoundingBox box = a;
+			box.Merge(b);
+			return box;
+		}
+
+		inline float SurfaceArea(const BoundingBox& box)
+		{
+			Vector3 size = box.GetSize();
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		inline BoundingBox Fattened(const BoundingBox& box, float margin)
+		{
+			Vector3 offset = Vector3(margin, margin, margin);
+			return BoundingBox(box.GetMin() - offset, box.GetMax() + offset);
+		}
+	}
+
+	AABBTree::AABBTree()
+	{
+		m_root			= -1;
+		m_freeList		= -1;
+		m_proxyCount	= 0;
+	}
+
+	//= PROXIES ==========================================================================================
+	int AABBTree::Insert(const BoundingBox& box, void* userData)
+	{
+		int proxy = Node_Allocate();
+		m_nodes[proxy].box		= Fattened(box, FAT_MARGIN);
+		m_nodes[proxy].userData	= userData;
+		m_nodes[proxy].height	= 0;
+
+		Leaf_Insert(proxy);
+		m_proxyCount++;
+
+		return proxy;
+	}
+
+	void AABBTree::Remove(int proxy)
+	{
+		if (proxy < 0 || proxy >= (int)m_nodes.size() || !m_nodes[proxy].IsLeaf() || m_nodes[proxy].height == -1)
+			return;
+
+		Leaf_Remove(proxy);
+		Node_Free(proxy);
+		m_proxyCount--;
+	}
+
+	void AABBTree::Remove_Deferred(int proxy)
+	{
+		lock_guard<mutex> lock(m_proxiesRemovedMutex);
+		m_proxiesRemoved.emplace_back(proxy);
+	}
+
+	void AABBTree::Remove_Pending()
+	{
+		vector<int> removed;
+		{
+			lock_guard<mutex> lock(m_proxiesRemovedMutex);
+			removed.swap(m_proxiesRemoved);
+		}
+
+		for (int proxy : removed)
+		{
+			Remove(proxy);
+		}
+	}
+
+	bool AABBTree::Move(int proxy, const BoundingBox& box)
+	{
+		// Still within the fattened box, and the fattened box isn't too loose either (the proxy could have shrunk)
+		const BoundingBox& current = m_nodes[proxy].box;
+		if (current.IsInside(box) == Inside && Fattened(box, FAT_MARGIN * 4.0f).IsInside(current) == Inside)
+			return false;
+
+		Leaf_Remove(proxy);
+		m_nodes[proxy].box = Fattened(box, FAT_MARGIN);
+		Leaf_Insert(proxy);
+
+		return true;
+	}
+
+	void AABBTree::Clear()
+	{
+		m_nodes.clear();
+		{
+			lock_guard<mutex> lock(m_proxiesRemovedMutex);
+			m_proxiesRemoved.clear();
+		}
+		m_root			= -1;
+		m_freeList		= -1;
+		m_proxyCount	= 0;
+	}
+	//====================================================================================================
+
+	//= QUERIES ==========================================================================================
+	void AABBTree::Query(const Frustum& frustum, vector<void*>* results) const
+	{
+		if (m_root == -1)
+			return;
+
+		// Leaves of partially visible nodes, they are tested in one batch at the end
+		vector<int> leaves;
+		vector<float> centerX, centerY, centerZ, extentX, extentY, extentZ;
+
+		vector<int> stack;
+		stack.reserve(64);
+		stack.emplace_back(m_root);
+		while (!stack.empty())
+		{
+			int index = stack.back();
+			stack.pop_back();
+
+			const Node& node = m_nodes[index];
+			if (node.IsLeaf())
+			{
+				Vector3 center = node.box.GetCenter();
+				Vector3 extent = node.box.GetExtents();
+				leaves.emplace_back(index);
+				centerX.emplace_back(center.x); centerY.emplace_back(center.y); centerZ.emplace_back(center.z);
+				extentX.emplace_back(extent.x); extentY.emplace_back(extent.y); extentZ.emplace_back(extent.z);
+				continue;
+			}
+
+			Intersection intersection = frustum.CheckCube(node.box.GetCenter(), node.box.GetExtents());
+			if (intersection == Outside)
+				continue;
+
+			// Everything below a node that is entirely inside is visible, no need to test any further
+			if (intersection == Inside)
+			{
+				CollectLeaves(index, results);
+				continue;
+			}
+
+			stack.emplace_back(node.left);
+			stack.emplace_back(node.right);
+		}
+
+		if (leaves.empty())
+			return;
+
+		vector<unsigned int> visibility((leaves.size() + 31) / 32);
+		frustum.CheckCubes(centerX.data(), centerY.data(), centerZ.data(), extentX.data(), extentY.data(), extentZ.data(), (unsigned int)leaves.size(), visibility.data());
+		for (unsigned int i = 0; i < (unsigned int)leaves.size(); i++)
+		{
+			if (visibility[i >> 5] & (1u << (i & 31)))
+			{
+				results->emplace_back(m_nodes[leaves[i]].userData);
+			}
+		}
+	}
+
+	void AABBTree::Query(const BoundingBox& box, vector<void*>* results) const
+	{
+		if (m_root == -1)
+			return;
+
+		vector<int> stack;
+		stack.reserve(64);
+		stack.emplace_back(m_root);
+		while (!stack.empty())
+		{
+			const Node& node = m_nodes[stack.back()];
+			stack.pop_back();
+
+			if (box.IsInside(node.box) == Outside)
+				continue;
+
+			if (node.IsLeaf())
+			{
+				results->emplace_back(node.userData);
+				continue;
+			}
+
+			stack.emplace_back(node.left);
+			stack.emplace_back(node.right);
+		}
+	}
+
+	void AABBTree::Query(const Vector3& center, float radius, vector<void*>* results) const
+	{
+		if (m_root == -1)
+			return;
+
+		float radiusSquared = radius * radius;
+
+		vector<int> stack;
+		stack.reserve(64);
+		stack.emplace_back(m_root);
+		while (!stack.empty())
+		{
+			const Node& node = m_nodes[stack.back()];
+			stack.pop_back();
+
+			// Squared distance from the center to the closest point of the box
+			const Vector3& min	= node.box.GetMin();
+			const Vector3& max	= node.box.GetMax();
+			Vector3 closest		= Vector3(Clamp(center.x, min.x, max.x), Clamp(center.y, min.y, max.y), Clamp(center.z, min.z, max.z));
+			if (Vector3::LengthSquared(center, closest) > radiusSquared)
+				continue;
+
+			if (node.IsLeaf())
+			{
+				results->emplace_back(node.userData);
+				continue;
+			}
+
+			stack.emplace_back(node.left);
+			stack.emplace_back(node.right);
+		}
+	}
+
+	void* AABBTree::Raycast(const Ray& ray, const function<float(void*)>& closestHit) const
+	{
+		if (m_root == -1)
+			return nullptr;
+
+		void* hit		= nullptr;
+		float hitMin	= INFINITY;
+
+		vector<pair<int, float>> stack;
+		stack.reserve(64);
+		stack.emplace_back(m_root, ray.HitDistance(m_nodes[m_root].box));
+		while (!stack.empty())
+		{
+			int index		= stack.back().first;
+			float distance	= stack.back().second;
+			stack.pop_back();
+
+			// Can't be closer than what we already have
+			if (distance == INFINITY || distance > hitMin)
+				continue;
+
+			const Node& node = m_nodes[index];
+			if (node.IsLeaf())
+			{
+				float hitDistance = closestHit(node.userData);
+				if (hitDistance < hitMin)
+				{
+					hit		= node.userData;
+					hitMin	= hitDistance;
+				}
+				continue;
+			}
+
+			// Push the nearest child last, so that it's visited first
+			float distanceLeft	= ray.HitDistance(m_nodes[node.left].box);
+			float distanceRight	= ray.HitDistance(m_nodes[node.right].box);
+			if (distanceLeft < distanceRight)
+			{
+				stack.emplace_back(node.right, distanceRight);
+				stack.emplace_back(node.left, distanceLeft);
+			}
+			else
+			{
+				stack.emplace_back(node.left, distanceLeft);
+				stack.emplace_back(node.right, distanceRight);
+			}
+		}
+
+		return hit;
+	}
+	//====================================================================================================
+
+	//= TREE =============================================================================================
+	int AABBTree::Node_Allocate()
+	{
+		if (m_freeList == -1)
+		{
+			m_nodes.emplace_back();
+			return (int)m_nodes.size() - 1;
+		}
+
+		int node	= m_freeList;
+		m_freeList	= m_nodes[node].parent;
+		m_nodes[node] = Node();
+
+		return node;
+	}
+
+	void AABBTree::Node_Free(int node)
+	{
+		m_nodes[node]			= Node();
+		m_nodes[node].parent	= m_freeList;
+		m_freeList				= node;
+	}
+
+	void AABBTree::Leaf_Insert(int leaf)
+	{
+		if (m_root == -1)
+		{
+			m_root					= leaf;
+			m_nodes[leaf].parent	= -1;
+			return;
+		}
+
+		// Find the best sibling, using the surface area heuristic
+		BoundingBox leafBox	= m_nodes[leaf].box;
+		int index			= m_root;
+		while (!m_nodes[index].IsLeaf())
+		{
+			const Node& node	= m_nodes[index];
+			float area			= SurfaceArea(node.box);
+			float combinedArea	= SurfaceArea(Merged(node.box, leafBox));
+
+			// Cost of creating a new parent for this node and the new leaf
+			float cost = 2.0f * combinedArea;
+			// Minimum cost of pushing the leaf further down the tree
+			float costInheritance = 2.0f * (combinedArea - area);
+
+			auto costDescend = [this, &leafBox, costInheritance](int child)
+			{
+				const Node& node = m_nodes[child];
+				float area = SurfaceArea(Merged(leafBox, node.box));
+				return (node.IsLeaf() ? area : area - SurfaceArea(node.box)) + costInheritance;
+			};
+			float costLeft	= costDescend(node.left);
+			float costRight	= costDescend(node.right);
+
+			if (cost < costLeft && cost < costRight)
+				break;
+
+			index = costLeft < costRight ? node.left : node.right;
+		}
+		int sibling = index;
+
+		// Create a new parent (this can grow the nodes, so no references are held across it)
+		int parentOld = m_nodes[sibling].parent;
+		int parentNew = Node_Allocate();
+		m_nodes[parentNew].parent	= parentOld;
+		m_nodes[parentNew].box		= Merged(leafBox, m_nodes[sibling].box);
+		m_nodes[parentNew].height	= m_nodes[sibling].height + 1;
+		m_nodes[parentNew].left		= sibling;
+		m_nodes[parentNew].right	= leaf;
+		m_nodes[sibling].parent		= parentNew;
+		m_nodes[leaf].parent		= parentNew;
+
+		if (parentOld != -1)
+		{
+			if (m_nodes[parentOld].left == sibling)
+			{
+				m_nodes[parentOld].left = parentNew;
+			}
+			else
+			{
+				m_nodes[parentOld].right = parentNew;
+			}
+		}
+		else
+		{
+			m_root = parentNew;
+		}
+
+		Refit(m_nodes[leaf].parent);
+	}
+
+	void AABBTree::Leaf_Remove(int leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = -1;
+			return;
+		}
+
+		int parent		= m_nodes[leaf].parent;
+		int grandParent	= m_nodes[parent].parent;
+		int sibling		= m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+		// The sibling takes the place of the parent
+		if (grandParent != -1)
+		{
+			if (m_nodes[grandParent].left == parent)
+			{
+				m_nodes[grandParent].left = sibling;
+			}
+			else
+			{
+				m_nodes[grandParent].right = sibling;
+			}
+			m_nodes[sibling].parent = grandParent;
+			Node_Free(parent);
+
+			Refit(grandParent);
+		}
+		else
+		{
+			m_root					= sibling;
+			m_nodes[sibling].parent	= -1;
+			Node_Free(parent);
+		}
+		m_nodes[leaf].parent = -1;
+	}
+
+	void AABBTree::Refit(int node)
+	{
+		// Walk up to the root, re-balancing and fixing the boxes and heights on the way
+		while (node != -1)
+		{
+			node = Balance(node);
+
+			Node& n		= m_nodes[node];
+			n.height	= 1 + Max(m_nodes[n.left].height, m_nodes[n.right].height);
+			n.box		= Merged(m_nodes[n.left].box, m_nodes[n.right].box);
+
+			node = n.parent;
+		}
+	}
+
+	int AABBTree::Balance(int iA)
+	{
+		Node& A = m_nodes[iA];
+		if (A.IsLeaf() || A.height < 2)
+			return iA;
+
+		int iB		= A.left;
+		int iC		= A.right;
+		Node& B		= m_nodes[iB];
+		Node& C		= m_nodes[iC];
+		int balance	= C.height - B.height;
+
+		// Rotate C up
+		if (balance > 1)
+		{
+			int iF	= C.left;
+			int iG	= C.right;
+			Node& F	= m_nodes[iF];
+			Node& G	= m_nodes[iG];
+
+			// Swap A and C
+			C.left		= iA;
+			C.parent	= A.parent;
+			A.parent	= iC;
+
+			if (C.parent != -1)
+			{
+				if (m_nodes[C.parent].left == iA)
+				{
+					m_nodes[C.parent].left = iC;
+				}
+				else
+				{
+					m_nodes[C.parent].right = iC;
+				}
+			}
+			else
+			{
+				m_root = iC;
+			}
+
+			// Rotate
+			if (F.height > G.height)
+			{
+				C.right		= iF;
+				A.right		= iG;
+				G.parent	= iA;
+				A.box		= Merged(B.box, G.box);
+				C.box		= Merged(A.box, F.box);
+				A.height	= 1 + Max(B.height, G.height);
+				C.height	= 1 + Max(A.height, F.height);
+			}
+			else
+			{
+				C.right		= iG;
+				A.right		= iF;
+				F.parent	= iA;
+				A.box		= Merged(B.box, F.box);
+				C.box		= Merged(A.box, G.box);
+				A.height	= 1 + Max(B.height, F.height);
+				C.height	= 1 + Max(A.height, G.height);
+			}
+
+			return iC;
+		}
+
+		// Rotate B up
+		if (balance < -1)
+		{
+			int iD	= B.left;
+			int iE	= B.right;
+			Node& D	= m_nodes[iD];
+			Node& E	= m_nodes[iE];
+
+			// Swap A and B
+			B.left		= iA;
+			B.parent	= A.parent;
+			A.parent	= iB;
+
+			if (B.parent != -1)
+			{
+				if (m_nodes[B.parent].left == iA)
+				{
+					m_nodes[B.parent].left = iB;
+				}
+				else
+				{
+					m_nodes[B.parent].right = iB;
+				}
+			}
+			else
+			{
+				m_root = iB;
+			}
+
+			// Rotate
+			if (D.height > E.height)
+			{
+				B.right		= iD;
+				A.left		= iE;
+				E.parent	= iA;
+				A.box		= Merged(C.box, E.box);
+				B.box		= Merged(A.box, D.box);
+				A.height	= 1 + Max(C.height, E.height);
+				B.height	= 1 + Max(A.height, D.height);
+			}
+			else
+			{
+				B.right		= iE;
+				A.left		= iD;
+				D.parent	= iA;
+				A.box		= Merged(C.box, D.box);
+				B.box		= Merged(A.box, E.box);
+				A.height	= 1 + Max(C.height, D.height);
+				B.height	= 1 + Max(A.height, E.height);
+			}
+
+			return iB;
+		}
+
+		return iA;
+	}
+
+	void AABBTree::CollectLeaves(int node, vector<void*>* results) const
+	{
+		const Node& n = m_nodes[node];
+		if (n.IsLeaf())
+		{
+			results->emplace_back(n.userData);
+			return;
+		}
+
+		CollectLeaves(n.left, results);
+		CollectLeaves(n.right, results);
+	}
+	//====================================================================================================
+}
@@ -0,0 +1,101 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ========================
+#include <vector>
+#include <mutex>
+#include <functional>
+#include "../Core/EngineDefs.h"
+#include "../Math/BoundingBox.h"
+//===================================
+
+namespace Directus
+{
+	namespace Math
+	{
+		class Frustum;
+		class Ray;
+	}
+
+	// A dynamic bounding volume hierarchy. Every proxy is stored with a slightly fattened box, so small
+	// movements don't touch the tree at all, and the tree is kept balanced with rotations as it changes.
+	class ENGINE_CLASS AABBTree
+	{
+	public:
+		AABBTree();
+		~AABBTree() {}
+
+		//= PROXIES ====================================================================
+		// Returns the proxy that represents the box in the tree
+		int Insert(const Math::BoundingBox& box, void* userData);
+		void Remove(int proxy);
+		// Can be called from any thread, the proxy is removed by the next Remove_Pending()
+		void Remove_Deferred(int proxy);
+		void Remove_Pending();
+		// Returns false if the box is still within the fattened one (nothing changed)
+		bool Move(int proxy, const Math::BoundingBox& box);
+		void* GetUserData(int proxy) const					{ return m_nodes[proxy].userData; }
+		const Math::BoundingBox& GetBox(int proxy) const	{ return m_nodes[proxy].box; }
+		unsigned int GetProxyCount() const					{ return m_proxyCount; }
+		void Clear();
+		//==============================================================================
+
+		//= QUERIES =======================================================================================
+		// The user data of every proxy that overlaps the volume is appended to the results
+		void Query(const Math::Frustum& frustum, std::vector<void*>* results) const;
+		void Query(const Math::BoundingBox& box, std::vector<void*>* results) const;
+		void Query(const Math::Vector3& center, float radius, std::vector<void*>* results) const;
+		// Visits the proxies front to back, closestHit() returns the actual hit distance (or INFINITY)
+		// so that the subtrees beyond the closest hit so far can be skipped. Returns the closest user data.
+		void* Raycast(const Math::Ray& ray, const std::function<float(void*)>& closestHit) const;
+		//=================================================================================================
+
+	private:
+		struct Node
+		{
+			bool IsLeaf() const { return left == -1; }
+
+			Math::BoundingBox box;
+			void* userData	= nullptr;
+			int parent		= -1; // Next free node, when in the free list
+			int left		= -1;
+			int right		= -1;
+			int height		= -1; // -1 when free
+		};
+
+		int Node_Allocate();
+		void Node_Free(int node);
+		void Leaf_Insert(int leaf);
+		void Leaf_Remove(int leaf);
+		int Balance(int node);
+		void Refit(int node);
+		void CollectLeaves(int node, std::vector<void*>* results) const;
+
+		std::vector<Node> m_nodes;
+		int m_root;
+		int m_freeList;
+		unsigned int m_proxyCount;
+		std::vector<int> m_proxiesRemoved;
+		std::mutex m_proxiesRemovedMutex;
+	};
+}
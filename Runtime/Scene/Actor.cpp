@@ -20,6 +20,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
 //= INCLUDES ==========================================
+#include <algorithm>
 #include "Actor.h"
 #include "Scene.h"
 #include "../Scene/Components/Camera.h"
@@ -64,13 +65,15 @@ namespace Directus
 	Actor::~Actor()
 	{
 		// delete components
-		for (auto it = m_components.begin(); it != m_components.end(); )
+		for (const auto& component : m_components)
 		{
-			(*it).second->OnRemove();
-			(*it).second.reset();
-			it = m_components.erase(it);
+			component->OnRemove();
 		}
 		m_components.clear();
+		for (auto& component : m_componentsByType)
+		{
+			component.reset();
+		}
 
 		m_ID = NOT_ASSIGNED_HASH;
 		m_name.clear();
@@ -83,6 +86,26 @@ namespace Directus
 		m_transform = transform;
 	}
 
+	void Actor::SetName(const string& name)
+	{
+		if (m_name == name)
+			return;
+
+		string previousName = m_name;
+		m_name = name;
+		m_context->GetSubsystem<Scene>()->Actor_OnNameChanged(this, previousName);
+	}
+
+	void Actor::SetID(unsigned int ID)
+	{
+		if (m_ID == ID)
+			return;
+
+		unsigned int previousID = m_ID;
+		m_ID = ID;
+		m_context->GetSubsystem<Scene>()->Actor_OnIDChanged(this, previousID);
+	}
+
 	void Actor::Clone()
 	{
 		LOGF_INFO("Todo: Clone %s", m_name.c_str());
@@ -93,7 +116,7 @@ namespace Directus
 		// call component Start()
 		for (auto const& component : m_components)
 		{
-			component.second->OnStart();
+			component->OnStart();
 		}
 	}
 
@@ -102,19 +125,7 @@ namespace Directus
 		// call component Stop()
 		for (auto const& component : m_components)
 		{
-			component.second->OnStop();
-		}
-	}
-
-	void Actor::Update()
-	{
-		if (!m_isActive)
-			return;
-
-		// call component Update()
-		for (const auto& component : m_components)
-		{
-			component.second->OnUpdate();
+			component->OnStop();
 		}
 	}
 
@@ -162,13 +173,13 @@ namespace Directus
 		stream->Write((int)m_components.size());
 		for (const auto& component : m_components)
 		{
-			stream->Write((unsigned int)component.second->GetType());
-			stream->Write(component.second->GetID());
+			stream->Write((unsigned int)component->GetType());
+			stream->Write(component->GetID());
 		}
 
 		for (const auto& component : m_components)
 		{
-			component.second->Serialize(stream);
+			component->Serialize(stream);
 		}
 		//=============================================
 
@@ -206,8 +217,13 @@ namespace Directus
 		stream->Read(&m_isPrefab);
 		stream->Read(&m_isActive);
 		stream->Read(&m_hierarchyVisibility);
-		stream->Read(&m_ID);
-		stream->Read(&m_name);
+		// Through the setters, so that the scene's ID and name indices follow
+		unsigned int ID = 0;
+		string name;
+		stream->Read(&ID);
+		stream->Read(&name);
+		SetID(ID);
+		SetName(name);
 		//==================================
 
 		//= COMPONENTS ================================
@@ -228,7 +244,7 @@ namespace Directus
 		// the components (like above) and then deserialize them (like here).
 		for (const auto& component : m_components)
 		{
-			component.second->Deserialize(stream);
+			component->Deserialize(stream);
 		}
 		//=============================================
 
@@ -259,11 +275,6 @@ namespace Directus
 		}
 		//=============================================
 
-		if (m_transform)
-		{
-			m_transform->ResolveChildrenRecursively();
-		}
-
 		// Make the scene resolve
 		FIRE_EVENT(EVENT_SCENE_RESOLVE);
 	}
@@ -299,22 +310,61 @@ namespace Directus
 
 	void Actor::RemoveComponentByID(unsigned int id)
 	{
-		for (auto it = m_components.begin(); it != m_components.end(); ) 
+		for (unsigned int i = 0; i < (unsigned int)m_components.size(); i++)
 		{
-			auto component = *it;
-			if (id == component.second->GetID())
+			if (id == m_components[i]->GetID())
 			{
-				component.second->OnRemove();
-				component.second.reset();
-				it = m_components.erase(it);
-			}
-			else
-			{
-				++it;
+				Components_Remove(i);
+				break;
 			}
 		}
 
 		// Make the scene resolve
 		FIRE_EVENT(EVENT_SCENE_RESOLVE);
 	}
-}
+
+	void Actor::Components_Add(const shared_ptr<IComponent>& component)
+	{
+		ComponentType type = component->GetType();
+
+		// Insert after any components of the same type
+		auto it = upper_bound(m_components.begin(), m_components.end(), type, [](ComponentType type, const shared_ptr<IComponent>& component)
+		{
+			return type < component->GetType();
+		});
+		m_components.insert(it, component);
+
+		if (!m_componentsByType[type])
+		{
+			m_componentsByType[type] = component;
+		}
+	}
+
+	void Actor::Components_Remove(unsigned int index)
+	{
+		shared_ptr<IComponent> component = m_components[index];
+		ComponentType type = component->GetType();
+
+		component->OnRemove();
+		m_components.erase(m_components.begin() + index);
+
+		if (m_componentsByType[type] == component)
+		{
+			// Another component of the same type (scripts) takes its place
+			m_componentsByType[type].reset();
+			for (const auto& other : m_components)
+			{
+				if (other->GetType() == type)
+				{
+					m_componentsByType[type] = other;
+					break;
+				}
+			}
+		}
+
+		if (type == ComponentType_Renderable)
+		{
+			m_renderable = nullptr;
+		}
+	}
+}
\ No newline at end of file
@@ -22,8 +22,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 //= INCLUDES =====================
-#include <map>
+#include <vector>
 #include "Scene.h"
+#include "ComponentPool.h"
 #include "Components/IComponent.h"
 #include "../Core/Context.h"
 #include "../Core/EventSystem.h"
@@ -46,7 +47,6 @@ namespace Directus
 		//============
 		void Start();
 		void Stop();
-		void Update();
 		//============
 
 		bool SaveAsPrefab(const std::string& filePath);
@@ -57,10 +57,11 @@ namespace Directus
 
 		//= PROPERTIES =======================================================================================
 		const std::string& GetName() { return m_name; }
-		void SetName(const std::string& name) { m_name = name; }
+		void SetName(const std::string& name);
 
 		unsigned int GetID() { return m_ID; }
-		void SetID(unsigned int ID) { m_ID = ID; }
+		const ActorHandle& GetHandle() { return m_handle; }
+		void SetID(unsigned int ID);
 
 		bool IsActive() { return m_isActive; }
 		void SetActive(bool active) { m_isActive = active; }
@@ -78,16 +79,17 @@ namespace Directus
 
 			// Return component in case it already exists while ignoring Script components (they can exist multiple times)
 			if (HasComponent(type) && type != ComponentType_Script)
-				return std::static_pointer_cast<T>(GetComponent<T>().lock());
+				return GetComponent<T>();
 
-			// Add component
-			auto newComponent = std::make_shared<T>(
+			// Add component (allocated from the scene's pool for this type)
+			auto scene = m_context->GetSubsystem<Scene>();
+			auto newComponent = scene->GetComponentPool(type)->Create<T>(
 				m_context, 
-				m_context->GetSubsystem<Scene>()->GetActorByID(GetID()).lock().get(),
+				scene->GetActorByID(GetID()).lock().get(),
 				GetTransform_PtrRaw()
 				);
-			m_components.insert(make_pair(type, newComponent));
-			newComponent->SetType(IComponent::Type_To_Enum<T>());
+			newComponent->SetType(type);
+			Components_Add(newComponent);
 
 			// Register component
 			newComponent->OnInitialize();
@@ -113,10 +115,10 @@ namespace Directus
 		{
 			ComponentType type = IComponent::Type_To_Enum<T>();
 
-			if (m_components.find(type) == m_components.end())
+			if (!HasComponent(type))
 				return std::weak_ptr<T>();
 
-			return std::static_pointer_cast<T>(m_components.find(type)->second);
+			return std::static_pointer_cast<T>(m_componentsByType[type]);
 		}
 
 		// Returns any components of type T (if they exist)
@@ -128,17 +130,17 @@ namespace Directus
 			std::vector<std::weak_ptr<T>> components;
 			for (const auto& component : m_components)
 			{
-				if (type != component.second->GetType())
+				if (type != component->GetType())
 					continue;
 
-				components.emplace_back(std::static_pointer_cast<T>(component.second));
+				components.emplace_back(std::static_pointer_cast<T>(component));
 			}
 
 			return components;
 		}
 		
 		// Checks if a component of ComponentType exists
-		bool HasComponent(ComponentType type) { return m_components.find(type) != m_components.end(); }
+		bool HasComponent(ComponentType type) { return type < ComponentType_Unknown && m_componentsByType[type]; }
 		// Checks if a component of type T exists
 		template <class T>
 		bool HasComponent() { return HasComponent(IComponent::Type_To_Enum<T>()); }
@@ -149,21 +151,14 @@ namespace Directus
 		{
 			ComponentType type = IComponent::Type_To_Enum<T>();
 
-			if (m_components.find(type) == m_components.end())
+			if (!HasComponent(type))
 				return;
 
-			for (auto it = m_components.begin(); it != m_components.end(); )
+			for (unsigned int i = (unsigned int)m_components.size(); i > 0; i--)
 			{
-				auto component = *it;
-				if (type == component.second->GetType())
+				if (type == m_components[i - 1]->GetType())
 				{
-					component.second->OnRemove();
-					component.second.reset();
-					it = m_components.erase(it);
-				}
-				else
-				{
-					++it;
+					Components_Remove(i - 1);
 				}
 			}
 
@@ -180,12 +175,23 @@ namespace Directus
 		std::shared_ptr<Actor> GetPtrShared() { return shared_from_this(); }
 
 	private:
+		//= COMPONENTS ========================================================
+		void Components_Add(const std::shared_ptr<IComponent>& component);
+		void Components_Remove(unsigned int index);
+		//=====================================================================
+
+		friend class Scene;
+
 		unsigned int m_ID;
+		ActorHandle m_handle;
 		std::string m_name;
 		bool m_isActive;
 		bool m_isPrefab;
 		bool m_hierarchyVisibility;
-		std::multimap<ComponentType, std::shared_ptr<IComponent>> m_components;
+		// Sorted by type, same order as they are saved in
+		std::vector<std::shared_ptr<IComponent>> m_components;
+		// The first component of each type
+		std::shared_ptr<IComponent> m_componentsByType[ComponentType_Unknown];
 		Context* m_context;
 
 		// Caching of performance critical components
@@ -0,0 +1,46 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+namespace Directus
+{
+	// Identifies an actor by the slot it occupies in the scene and the generation of that slot. Once the actor 
+	// is removed the generation changes, so old handles resolve to nothing instead of to whatever reuses the slot.
+	struct ActorHandle
+	{
+		ActorHandle() = default;
+		ActorHandle(unsigned int index, unsigned int generation)
+		{
+			this->index			= index;
+			this->generation	= generation;
+		}
+
+		// Generation 0 is never handed out, so a default constructed handle is always null
+		bool IsNull() const { return generation == 0; }
+
+		bool operator==(const ActorHandle& rhs) const { return index == rhs.index && generation == rhs.generation; }
+		bool operator!=(const ActorHandle& rhs) const { return !(*this == rhs); }
+
+		unsigned int index		= 0;
+		unsigned int generation	= 0;
+	};
+}
\ No newline at end of file
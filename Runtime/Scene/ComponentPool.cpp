@@ -0,0 +1,163 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ===============
+#include "ComponentPool.h"
+#include "Actor.h"
+//==========================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+// Components per chunk of memory
+static const unsigned int COMPONENTS_PER_CHUNK = 64;
+
+namespace Directus
+{
+	void* BlockPool::Allocate(size_t size)
+	{
+		lock_guard<mutex> guard(m_mutex);
+
+		// The first allocation determines the block size
+		if (m_blockSize == 0)
+		{
+			m_blockSize = (size + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+		}
+
+		// Anything that doesn't fit (e.g. an array) goes to the heap
+		if (size > m_blockSize)
+			return ::operator new(size);
+
+		if (m_free.empty())
+		{
+			m_chunks.emplace_back(make_unique<unsigned char[]>(m_blockSize * m_blocksPerChunk));
+			unsigned char* chunk = m_chunks.back().get();
+
+			// Push in reverse, so that blocks are handed out in address order
+			for (unsigned int i = m_blocksPerChunk; i > 0; i--)
+			{
+				m_free.emplace_back(chunk + (i - 1) * m_blockSize);
+			}
+		}
+
+		void* block = m_free.back();
+		m_free.pop_back();
+		return block;
+	}
+
+	void BlockPool::Free(void* block, size_t size)
+	{
+		if (size > m_blockSize)
+		{
+			::operator delete(block);
+			return;
+		}
+
+		lock_guard<mutex> guard(m_mutex);
+		m_free.emplace_back(block);
+	}
+
+	ComponentPool::ComponentPool()
+	{
+		m_blocks = make_shared<BlockPool>(COMPONENTS_PER_CHUNK);
+	}
+
+	ComponentPool::~ComponentPool()
+	{
+		// Components which are still referenced should not call back to a destroyed pool
+		lock_guard<recursive_mutex> guard(m_mutex);
+		for (const auto& component : m_components)
+		{
+			if (component)
+			{
+				component->m_pool = nullptr;
+			}
+		}
+	}
+
+	void ComponentPool::Update()
+	{
+		// Held for the whole pass, other threads which add or remove components wait for it to end.
+		// It's recursive, as updating components can add or remove components themselves.
+		lock_guard<recursive_mutex> guard(m_mutex);
+		m_updating = true;
+
+		// Index based, as the array can grow while updating. What gets added is updated next frame.
+		unsigned int count = (unsigned int)m_components.size();
+		for (unsigned int i = 0; i < count; i++)
+		{
+			IComponent* component = m_components[i];
+			if (!component || !component->Getactor_PtrRaw()->IsActive())
+				continue;
+
+			component->OnUpdate();
+		}
+
+		// Compact what was removed while iterating
+		m_updating = false;
+		if (!m_hasRemoved)
+			return;
+
+		count = 0;
+		for (IComponent* component : m_components)
+		{
+			if (!component)
+				continue;
+
+			component->m_poolIndex	= count;
+			m_components[count++]	= component;
+		}
+		m_components.resize(count);
+		m_hasRemoved = false;
+	}
+
+	void ComponentPool::Register(IComponent* component)
+	{
+		lock_guard<recursive_mutex> guard(m_mutex);
+		component->m_pool		= this;
+		component->m_poolIndex	= (unsigned int)m_components.size();
+		m_components.emplace_back(component);
+	}
+
+	void ComponentPool::Unregister(IComponent* component)
+	{
+		lock_guard<recursive_mutex> guard(m_mutex);
+		unsigned int index = component->m_poolIndex;
+		component->m_pool = nullptr;
+
+		// While updating, a swap would move a component the iteration hasn't reached behind it
+		if (m_updating)
+		{
+			m_components[index]	= nullptr;
+			m_hasRemoved			= true;
+			return;
+		}
+
+		// Swap with the last component and pop
+		if (index != (unsigned int)m_components.size() - 1)
+		{
+			m_components[index] = m_components.back();
+			m_components[index]->m_poolIndex = index;
+		}
+		m_components.pop_back();
+	}
+}
@@ -0,0 +1,111 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES =============================
+#include <memory>
+#include <vector>
+#include <mutex>
+#include "Components/IComponent.h"
+//========================================
+
+namespace Directus
+{
+	// Hands out fixed size blocks from large chunks, so that objects of the same type sit next to each other in memory
+	class ENGINE_CLASS BlockPool
+	{
+	public:
+		BlockPool(unsigned int blocksPerChunk) { m_blocksPerChunk = blocksPerChunk; }
+
+		void* Allocate(size_t size);
+		void Free(void* block, size_t size);
+
+	private:
+		std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+		std::vector<void*> m_free;
+		size_t m_blockSize = 0;
+		unsigned int m_blocksPerChunk;
+		// The last reference to a component can be dropped by any thread
+		std::mutex m_mutex;
+	};
+
+	// Standard allocator on top of a BlockPool, used with std::allocate_shared. The allocator 
+	// keeps the pool alive, so that late weak references can still release their memory.
+	template <class T>
+	class PoolAllocator
+	{
+	public:
+		typedef T value_type;
+
+		PoolAllocator(const std::shared_ptr<BlockPool>& pool) : m_pool(pool) {}
+		template <class U>
+		PoolAllocator(const PoolAllocator<U>& other) : m_pool(other.m_pool) {}
+
+		T* allocate(size_t count)				{ return static_cast<T*>(m_pool->Allocate(count * sizeof(T))); }
+		void deallocate(T* block, size_t count)	{ m_pool->Free(block, count * sizeof(T)); }
+
+		template <class U>
+		bool operator==(const PoolAllocator<U>& other) const { return m_pool == other.m_pool; }
+		template <class U>
+		bool operator!=(const PoolAllocator<U>& other) const { return m_pool != other.m_pool; }
+
+		std::shared_ptr<BlockPool> m_pool;
+	};
+
+	// All the components of one type, allocated contiguously and kept 
+	// in a dense array so that they can be updated in a tight loop.
+	class ENGINE_CLASS ComponentPool
+	{
+	public:
+		ComponentPool();
+		~ComponentPool();
+
+		// Creates a component, it is removed from the pool when it gets destroyed
+		template <class T, class... Args>
+		std::shared_ptr<T> Create(Args&&... args)
+		{
+			auto component = std::allocate_shared<T>(PoolAllocator<T>(m_blocks), std::forward<Args>(args)...);
+			Register(component.get());
+			return component;
+		}
+
+		// Calls OnUpdate() on the components of active actors. Components removed meanwhile
+		// leave an empty slot behind, which is compacted once the iteration ends.
+		void Update();
+
+		const std::vector<IComponent*>& GetAll() { return m_components; }
+		unsigned int GetCount() { return (unsigned int)m_components.size(); }
+
+	private:
+		friend class IComponent;
+
+		void Register(IComponent* component);
+		void Unregister(IComponent* component);
+
+		std::shared_ptr<BlockPool> m_blocks;
+		std::vector<IComponent*> m_components;
+		bool m_updating		= false;
+		bool m_hasRemoved	= false;
+		// Components can be created and destroyed by any thread
+		std::recursive_mutex m_mutex;
+	};
+}
\ No newline at end of file
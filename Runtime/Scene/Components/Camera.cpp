@@ -32,6 +32,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../../Math/Frustum.h"
 #include "../../Rendering/Renderer.h"
 #include "../Actor.h"
+#include "../AABBTree.h"
 #include "Renderable.h"
 #include "../TransformationGizmo.h"
 //===================================
@@ -172,42 +173,30 @@ namespace Directus
 	}
 
 	//= RAYCASTING =======================================================================
-	weak_ptr<Actor> Camera::Pick(const Vector2& mousePos)
+	ActorHandle Camera::Pick(const Vector2& mousePos)
 	{
 		// Compute ray given the origin and end
 		m_ray = Ray(GetTransform()->GetPosition(), ScreenToWorldPoint(mousePos));
 
-		// Hits <Distance, actor>
-		map<float, std::weak_ptr<Actor>> hits;
-
-		// Find all the actors that the ray hits
-		vector<std::weak_ptr<Actor>> actors = GetContext()->GetSubsystem<Scene>()->GetRenderables();
-		for (const auto& actor : actors)
+		// Only the renderables along the ray are visited, closest first
+		auto hitDistance = [this](void* userData)
 		{
-			// Make sure there actor has a mesh and exclude the SkyBox
-			if (!actor.lock()->HasComponent<Renderable>() || actor.lock()->HasComponent<Skybox>())
-				continue;
-
-			// Get bounding box
-			BoundingBox bb = actor.lock()->GetComponent<Renderable>().lock()->Geometry_BB();
-
-			// Compute hit distance
-			float hitDistance = m_ray.HitDistance(bb);
+			// Exclude the SkyBox
+			Renderable* renderable = static_cast<Renderable*>(userData);
+			if (renderable->Getactor_PtrRaw()->HasComponent<Skybox>())
+				return INFINITY;
 
 			// Don't store hit data if we are inside the bounding box (0.0f) or there was no hit (INFINITY)
-			if (hitDistance == 0.0f || hitDistance == INFINITY)
-				continue;
-
-			hits[hitDistance] = actor;
-		}
-
-		// Get closest hit
-		weak_ptr<Actor> hit = !hits.empty() ? hits.begin()->second : weak_ptr<Actor>();
+			float distance = m_ray.HitDistance(renderable->Geometry_BB());
+			return distance == 0.0f ? INFINITY : distance;
+		};
+		auto renderable	= static_cast<Renderable*>(GetContext()->GetSubsystem<Scene>()->GetSpatialIndex()->Raycast(m_ray, hitDistance));
+		Actor* hit		= renderable ? renderable->Getactor_PtrRaw() : nullptr;
 
 		// Display transformation gizmo
 		m_transformGizmo->Pick(hit);
 
-		return hit;
+		return hit ? hit->GetHandle() : ActorHandle();
 	}
 
 	Vector2 Camera::WorldToScreenPoint(const Vector3& worldPoint)
@@ -30,6 +30,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../../Math/Ray.h"
 #include "../../Math/Frustum.h"
 #include "../../Math/Vector2.h"
+#include "../ActorHandle.h"
 //=========================================
 
 namespace Directus
@@ -69,7 +70,7 @@ namespace Directus
 		std::vector<RHI_Vertex_PosCol> GetPickingRay();
 
 		// Returns the nearest actor under the cursor
-		std::weak_ptr<Actor> Pick(const Math::Vector2& mousePos);
+		ActorHandle Pick(const Math::Vector2& mousePos);
 
 		// Converts a world point to a screen point
 		Math::Vector2 WorldToScreenPoint(const Math::Vector3& worldPoint);
@@ -34,6 +34,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Light.h"
 #include "Transform.h"
 #include "../Actor.h"
+#include "../ComponentPool.h"
 #include "../../Core/Context.h"
 #include "../../Core/GUIDGenerator.h"
 #include "../../FileSystem/FileSystem.h"
@@ -56,6 +57,14 @@ namespace Directus
 		m_ID			= GENERATE_GUID;
 	}
 
+	IComponent::~IComponent()
+	{
+		if (m_pool)
+		{
+			m_pool->Unregister(this);
+		}
+	}
+
 	shared_ptr<Actor> IComponent::Getactor_PtrShared()
 	{
 		return m_actor->GetPtrShared();
@@ -33,6 +33,7 @@ namespace Directus
 	class Transform;
 	class Context;
 	class FileStream;
+	class ComponentPool;
 
 	enum ComponentType : unsigned int
 	{
@@ -55,7 +56,7 @@ namespace Directus
 	{
 	public:
 		IComponent(Context* context, Actor* actor, Transform* transform);
-		virtual ~IComponent() {}
+		virtual ~IComponent();
 
 		// Runs when the component gets added
 		virtual void OnInitialize() {}
@@ -97,6 +98,8 @@ namespace Directus
 		//==============================================================================
 
 	protected:
+		friend class ComponentPool;
+
 		// The type of the component
 		ComponentType m_type		= ComponentType_Unknown;
 		// The id of the component
@@ -109,5 +112,8 @@ namespace Directus
 		Transform* m_transform		= nullptr;
 		// The context of the engine
 		Context* m_context			= nullptr;
+		// The pool that the component was allocated from, and its position in it
+		ComponentPool* m_pool		= nullptr;
+		unsigned int m_poolIndex	= 0;
 	};
 }
\ No newline at end of file
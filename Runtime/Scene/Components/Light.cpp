@@ -97,7 +97,8 @@ namespace Directus
 		// the scene which can look weird
 		ClampRotation();
 
-		if (auto mainCamera = GetContext()->GetSubsystem<Scene>()->GetMainCamera().lock().get())
+		Scene* scene = GetContext()->GetSubsystem<Scene>();
+		if (Actor* mainCamera = scene->GetActor(scene->GetMainCamera()))
 		{
 			if (auto cameraComp = mainCamera->GetComponent<Camera>().lock().get())
 			{
@@ -210,20 +211,18 @@ namespace Directus
 
 	Directus::Math::Matrix Light::ShadowMap_ComputeProjectionMatrix(unsigned int index /*= 0*/)
 	{
-		Camera* camera		= m_context->GetSubsystem<Scene>()->GetMainCamera().lock()->GetComponent<Camera>().lock().get();
+		BoundingBox bounds = ShadowMap_ComputeBounds(index);
+		return Matrix::CreateOrthoOffCenterLH(bounds.GetMin().x, bounds.GetMax().x, bounds.GetMin().y, bounds.GetMax().y, bounds.GetMin().z, bounds.GetMax().z);
+	}
+
+	BoundingBox Light::ShadowMap_ComputeBounds(unsigned int index /*= 0*/)
+	{
+		Scene* scene		= m_context->GetSubsystem<Scene>();
+		Actor* cameraActor	= scene->GetActor(scene->GetMainCamera());
+		Camera* camera		= cameraActor ? cameraActor->GetComponent<Camera>().lock().get() : nullptr;
 		Vector3 centerPos	= camera ? camera->GetTransform()->GetPosition() : Vector3::Zero;
 		Matrix mView		= ComputeViewMatrix();
-
-		// Hardcoded sizes to match the splits
-		float extents = 0;
-		if (index == 0)
-			extents = 10;
-
-		if (index == 1)
-			extents = 45;
-
-		if (index == 2)
-			extents = 90;
+		float extents		= ShadowMap_GetExtents(index);
 
 		Vector3 center	= centerPos * mView;
 		Vector3 min		= center - Vector3(extents, extents, extents);
@@ -241,7 +240,22 @@ namespace Directus
 		max *= fWorldUnitsPerTexel;
 		//================================================================================
 
-		return Matrix::CreateOrthoOffCenterLH(min.x, max.x, min.y, max.y, min.z, max.z);		
+		return BoundingBox(min, max);
+	}
+
+	float Light::ShadowMap_GetExtents(unsigned int index /*= 0*/)
+	{
+		// Hardcoded sizes to match the splits
+		if (index == 0)
+			return 10.0f;
+
+		if (index == 1)
+			return 45.0f;
+
+		if (index == 2)
+			return 90.0f;
+
+		return 0.0f;
 	}
 
 	void Light::ShadowMap_SetRenderTarget(unsigned int index /*= 0*/)
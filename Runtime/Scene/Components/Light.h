@@ -28,6 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../../Math/Vector4.h"
 #include "../../Math/Vector3.h"
 #include "../../Math/Matrix.h"
+#include "../../Math/BoundingBox.h"
 #include "../../RHI/RHI_Definition.h"
 //=========================================
 
@@ -92,6 +93,10 @@ namespace Directus
 		
 		// Shadow maps
 		Math::Matrix ShadowMap_ComputeProjectionMatrix(unsigned int index = 0);	
+		// The volume that a shadow map covers, in light space
+		Math::BoundingBox ShadowMap_ComputeBounds(unsigned int index = 0);
+		// Half the size of the (camera centered) box that a cascade covers
+		float ShadowMap_GetExtents(unsigned int index = 0);
 		void ShadowMap_SetRenderTarget(unsigned int index = 0);
 		void* ShadowMap_GetShaderResource(unsigned int index = 0);
 		float ShadowMap_GetSplit(unsigned int index = 0);
@@ -99,6 +104,7 @@ namespace Directus
 		std::shared_ptr<Math::Frustum> ShadowMap_IsInViewFrustrum(unsigned int index = 0);
 		int ShadowMap_GetResolution()		{ return m_shadowMapResolution; }
 		unsigned int ShadowMap_GetCount()	{ return m_shadowMapCount; }
+		const std::vector<std::shared_ptr<D3D11_RenderTexture>>& ShadowMap_GetAll() { return m_shadowMaps; }
 
 	private:
 		void ShadowMap_Create(bool force);
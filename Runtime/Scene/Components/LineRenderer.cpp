@@ -25,7 +25,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../../Math/Matrix.h"
 #include "../../Math/BoundingBox.h"
 #include "../../RHI/RHI_Definition.h"
-#include "../../RHI/D3D11/D3D11_Device.h"
+#include "../../RHI/RHI_Implementation.h"
 //=================================================
 
 //= NAMESPACES ================
@@ -22,6 +22,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ========================================
 #include "Renderable.h"
 #include "Transform.h"
+#include "../Scene.h"
+#include "../AABBTree.h"
 #include "../../RHI/RHI_Vertex.h"
 #include "../../Rendering/Material.h"
 #include "../../Rendering/Deferred/ShaderVariation.h"
@@ -44,7 +46,7 @@ namespace Directus
 	{
 		inline void Build(GeometryType type, Renderable* renderable)
 		{	
-			Model* model = new Model(renderable->GetContext());
+			auto model = make_shared<Model>(renderable->GetContext());
 			vector<RHI_Vertex_PosUVTBN> vertices;
 			vector<unsigned int> indices;
 
@@ -88,7 +90,7 @@ namespace Directus
 				0,
 				(unsigned int)vertices.size(),
 				BoundingBox(vertices),
-				model
+				model.get()
 			);
 		}
 	}
@@ -102,15 +104,21 @@ namespace Directus
 		m_geometryVertexCount	= 0;
 		m_materialDefault		= false;
 		m_materialRef			= nullptr;
+		m_model					= nullptr;
 		m_castShadows			= true;
 		m_receiveShadows		= true;
+		m_worldAABBDirty		= true;
+		m_spatialProxy			= -1;
+		Scene* scene			= context->GetSubsystem<Scene>();
+		m_spatialIndex			= scene ? scene->GetSpatialIndex() : nullptr;
 	}
 
 	Renderable::~Renderable()
 	{
-		if (m_geometryType != Geometry_Custom)
+		// Renderables can be destroyed by a loader thread, the index is only changed by the scene's update
+		if (m_spatialIndex && m_spatialProxy != -1)
 		{
-			delete m_model;
+			m_spatialIndex->Remove_Deferred(m_spatialProxy);
 		}
 	}
 
@@ -132,7 +140,7 @@ namespace Directus
 		stream->Write(m_materialDefault);
 		if (!m_materialDefault)
 		{
-			stream->Write(!m_materialRefWeak.expired() ? m_materialRefWeak.lock()->GetResourceName() : NOT_ASSIGNED);
+			stream->Write(m_materialRefShared ? m_materialRefShared->GetResourceName() : NOT_ASSIGNED);
 		}
 	}
 
@@ -145,9 +153,12 @@ namespace Directus
 		m_geometryVertexOffset	= stream->ReadUInt();
 		m_geometryVertexCount	= stream->ReadUInt();
 		stream->Read(&m_geometryAABB);
+		m_worldAABBDirty = true;
+		GetTransform()->UpdateTransform(); // Gets the renderable (re)inserted in the spatial index
 		string modelName;
 		stream->Read(&modelName);
-		m_model = m_context->GetSubsystem<ResourceManager>()->GetResourceByName<Model>(modelName).lock().get();
+		m_modelShared	= m_context->GetSubsystem<ResourceManager>()->GetResourceByName<Model>(modelName).lock();
+		m_model			= m_modelShared.get();
 
 		// If it was a default mesh, we have to reconstruct it
 		if (m_geometryType != Geometry_Custom) 
@@ -167,8 +178,8 @@ namespace Directus
 		{
 			string materialName;
 			stream->Read(&materialName);
-			m_materialRefWeak	= m_context->GetSubsystem<ResourceManager>()->GetResourceByName<Material>(materialName);
-			m_materialRef		= m_materialRefWeak.lock().get();
+			m_materialRefShared	= m_context->GetSubsystem<ResourceManager>()->GetResourceByName<Material>(materialName).lock();
+			m_materialRef		= m_materialRefShared.get();
 		}
 	}
 	//==============================================================================
@@ -183,6 +194,11 @@ namespace Directus
 		m_geometryVertexCount	= vertexCount;
 		m_geometryAABB			= AABB;
 		m_model					= model;
+		m_modelShared			= model ? static_pointer_cast<Model>(model->GetSharedPtr()) : nullptr; // Models are always owned by a shared_ptr
+		m_worldAABBDirty		= true;
+
+		// The spatial index is updated with the rest of the scene, once the transform store reports the change
+		GetTransform()->UpdateTransform();
 	}
 
 	void Renderable::Geometry_Set(GeometryType type)
@@ -206,9 +222,43 @@ namespace Directus
 		m_model->Geometry_Get(m_geometryIndexOffset, m_geometryIndexCount, m_geometryVertexOffset, m_geometryVertexCount, indices, vertices);
 	}
 
-	BoundingBox Renderable::Geometry_BB()
+	const BoundingBox& Renderable::Geometry_BB()
 	{
-		return m_geometryAABB.Transformed(GetTransform()->GetWorldTransform());
+		const Matrix& world = GetTransform()->GetWorldTransform();
+		if (m_worldAABBDirty || world != m_worldAABBTransform)
+		{
+			m_worldAABB				= m_geometryAABB.Transformed(world);
+			m_worldAABBTransform	= world;
+			m_worldAABBDirty		= false;
+		}
+
+		return m_worldAABB;
+	}
+
+	void Renderable::Geometry_UpdateSpatialIndex()
+	{
+		if (!m_spatialIndex)
+			return;
+
+		// Nothing to draw, nothing to find
+		if (!m_model)
+		{
+			if (m_spatialProxy != -1)
+			{
+				m_spatialIndex->Remove(m_spatialProxy);
+				m_spatialProxy = -1;
+			}
+			return;
+		}
+
+		if (m_spatialProxy == -1)
+		{
+			m_spatialProxy = m_spatialIndex->Insert(Geometry_BB(), this);
+		}
+		else
+		{
+			m_spatialIndex->Move(m_spatialProxy, Geometry_BB());
+		}
 	}
 	//==============================================================================
 
@@ -228,8 +278,8 @@ namespace Directus
 		{
 			if (auto cachedMat = material->Cache<Material>().lock())
 			{
-				m_materialRefWeak = cachedMat;
-				m_materialRef = m_materialRefWeak.lock().get();
+				m_materialRefShared = cachedMat;
+				m_materialRef = m_materialRefShared.get();
 				if (cachedMat->HasFilePath())
 				{
 					m_materialRef->SaveToFile(material->GetResourceFilePath());
@@ -239,8 +289,8 @@ namespace Directus
 		}
 		else
 		{
-			m_materialRefWeak = material;
-			m_materialRef = m_materialRefWeak.lock().get();
+			m_materialRefShared = material;
+			m_materialRef = m_materialRefShared.get();
 		}
 	}
 
@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <vector>
 #include "../../RHI/RHI_Definition.h"
 #include "../../Math/BoundingBox.h"
+#include "../../Math/Matrix.h"
 //=========================================
 
 namespace Directus
@@ -34,6 +35,7 @@ namespace Directus
 	class Mesh;
 	class Light;
 	class Material;
+	class AABBTree;
 	namespace Math
 	{
 		class Vector3;
@@ -79,8 +81,12 @@ namespace Directus
 		GeometryType Geometry_Type()					{ return m_geometryType; }
 		const std::string& Geometry_Name()				{ return m_geometryName; }
 		Model* Geometry_Model()							{ return m_model; }
+		const std::shared_ptr<Model>& Geometry_ModelShared() { return m_modelShared; }
 		const Math::BoundingBox& Geometry_AABB() const	{ return m_geometryAABB; }
-		Math::BoundingBox Geometry_BB();
+		// World space bounding box, only re-computed when the world transform changes
+		const Math::BoundingBox& Geometry_BB();
+		// Inserts or moves the renderable within the scene's spatial index
+		void Geometry_UpdateSpatialIndex();
 		//===============================================================================================
 
 		//= MATERIAL =========================================================================
@@ -91,9 +97,10 @@ namespace Directus
 		std::weak_ptr<Material> Material_Set(const std::string& filePath);
 
 		void Material_UseDefault();
-		std::weak_ptr<Material> Material_RefWeak()	{ return m_materialRefWeak; }
+		std::weak_ptr<Material> Material_RefWeak()	{ return m_materialRefShared; }
 		Material* Material_Ref()					{ return m_materialRef; }
-		bool Material_Exists()						{ return !m_materialRefWeak.expired(); }
+		const std::shared_ptr<Material>& Material_RefShared() { return m_materialRefShared; }
+		bool Material_Exists()						{ return m_materialRefShared != nullptr; }
 		std::string Material_Name();
 		//====================================================================================
 
@@ -113,11 +120,20 @@ namespace Directus
 		unsigned int m_geometryVertexCount;
 		Math::BoundingBox m_geometryAABB;
 		Model* m_model;
+		std::shared_ptr<Model> m_modelShared; // Owns default geometry, shares loaded models with the resource cache
 		GeometryType m_geometryType;
 		//==================================
 
+		//= BOUNDS =====================================
+		Math::BoundingBox m_worldAABB;
+		Math::Matrix m_worldAABBTransform;	// The world transform m_worldAABB was computed with
+		bool m_worldAABBDirty;
+		AABBTree* m_spatialIndex;
+		int m_spatialProxy;
+		//==============================================
+
 		//= MATERIAL =============================
-		std::weak_ptr<Material> m_materialRefWeak;
+		std::shared_ptr<Material> m_materialRefShared; // Held so that the resource cache doesn't evict it
 		Material* m_materialRef;
 		//========================================
 
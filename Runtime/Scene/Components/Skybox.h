@@ -44,6 +44,7 @@ namespace Directus
 
 		//= MISC ==================
 		void** GetShaderResource();
+		std::shared_ptr<RHI_Texture> GetTexture() { return m_cubemapTexture; }
 		//=========================
 
 		std::weak_ptr<Material> GetMaterial() { return m_matSkybox;}
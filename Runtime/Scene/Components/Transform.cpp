@@ -37,17 +37,27 @@ namespace Directus
 {
 	Transform::Transform(Context* context, Actor* actor, Transform* transform) : IComponent(context, actor, transform)
 	{
-		m_positionLocal		= Vector3::Zero;
-		m_rotationLocal		= Quaternion(0, 0, 0, 1);
-		m_scaleLocal		= Vector3::One;
-		m_worldTransform	= Matrix::Identity;
-		m_localTransform	= Matrix::Identity;
-		m_parent			= nullptr;
+		m_store		= context->GetSubsystem<Scene>()->GetTransformStore();
+		m_storeSlot	= m_store->Add(this);
+
+		m_parent		= nullptr;
+		m_firstChild	= nullptr;
+		m_lastChild		= nullptr;
+		m_prevSibling	= nullptr;
+		m_nextSibling	= nullptr;
+		m_childrenCount	= 0;
 	}
 
 	Transform::~Transform()
 	{
+		// Make sure no transform is left pointing to this one
+		UnlinkFromParent();
+		while (m_firstChild)
+		{
+			m_firstChild->BecomeOrphan();
+		}
 
+		m_store->Remove(m_storeSlot);
 	}
 
 	//= ICOMPONENT ==================================================================================
@@ -58,23 +68,30 @@ namespace Directus
 
 	void Transform::Serialize(FileStream* stream)
 	{
-		stream->Write(m_positionLocal);
-		stream->Write(m_rotationLocal);
-		stream->Write(m_scaleLocal);
+		stream->Write(GetPositionLocal());
+		stream->Write(GetRotationLocal());
+		stream->Write(GetScaleLocal());
 		stream->Write(m_lookAt);
 		stream->Write(m_parent ? m_parent->Getactor_PtrRaw()->GetID() : NOT_ASSIGNED_HASH);
 	}
 
 	void Transform::Deserialize(FileStream* stream)
 	{
+		Vector3 positionLocal;
+		Quaternion rotationLocal;
+		Vector3 scaleLocal;
 		unsigned int parentactorID = 0;
 
-		stream->Read(&m_positionLocal);
-		stream->Read(&m_rotationLocal);
-		stream->Read(&m_scaleLocal);
+		stream->Read(&positionLocal);
+		stream->Read(&rotationLocal);
+		stream->Read(&scaleLocal);
 		stream->Read(&m_lookAt);
 		stream->Read(&parentactorID);
 
+		m_store->SetPositionLocal(m_storeSlot, positionLocal);
+		m_store->SetRotationLocal(m_storeSlot, rotationLocal);
+		m_store->SetScaleLocal(m_storeSlot, scaleLocal);
+
 		if (parentactorID != NOT_ASSIGNED_HASH)
 		{
 			auto parent = GetContext()->GetSubsystem<Scene>()->GetActorByID(parentactorID);
@@ -89,24 +106,8 @@ namespace Directus
 	//===============================================================================================
 	void Transform::UpdateTransform()
 	{
-		// Compute local transform
-		m_localTransform = Matrix(m_positionLocal, m_rotationLocal, m_scaleLocal);
-
-		// Compute world transform
-		if (!HasParent())
-		{
-			m_worldTransform = m_localTransform;
-		}
-		else
-		{
-			m_worldTransform = m_localTransform * GetParentTransformMatrix();
-		}
-		
-		// Update children
-		for (const auto& child : m_children)
-		{
-			child->UpdateTransform();
-		}
+		// The store propagates the change to the children once per frame
+		m_store->MarkDirty(m_storeSlot);
 	}
 
 	//= TRANSLATION ==================================================================================
@@ -120,11 +121,10 @@ namespace Directus
 
 	void Transform::SetPositionLocal(const Vector3& position)
 	{
-		if (m_positionLocal == position)
+		if (GetPositionLocal() == position)
 			return;
 
-		m_positionLocal = position;
-		UpdateTransform();
+		m_store->SetPositionLocal(m_storeSlot, position);
 	}
 	//================================================================================================
 
@@ -139,11 +139,10 @@ namespace Directus
 
 	void Transform::SetRotationLocal(const Quaternion& rotation)
 	{
-		if (m_rotationLocal == rotation)
+		if (GetRotationLocal() == rotation)
 			return;
 
-		m_rotationLocal = rotation;
-		UpdateTransform();
+		m_store->SetRotationLocal(m_storeSlot, rotation);
 	}
 	//================================================================================================
 
@@ -158,18 +157,17 @@ namespace Directus
 
 	void Transform::SetScaleLocal(const Vector3& scale)
 	{
-		if (m_scaleLocal == scale)
+		if (GetScaleLocal() == scale)
 			return;
 
-		m_scaleLocal = scale;
-
 		// A scale of 0 will cause a division by zero when 
 		// decomposing the world transform matrix.
-		m_scaleLocal.x = (m_scaleLocal.x == 0.0f) ? M_EPSILON : m_scaleLocal.x;
-		m_scaleLocal.y = (m_scaleLocal.y == 0.0f) ? M_EPSILON : m_scaleLocal.y;
-		m_scaleLocal.z = (m_scaleLocal.z == 0.0f) ? M_EPSILON : m_scaleLocal.z;
+		Vector3 scaleLocal = scale;
+		scaleLocal.x = (scaleLocal.x == 0.0f) ? M_EPSILON : scaleLocal.x;
+		scaleLocal.y = (scaleLocal.y == 0.0f) ? M_EPSILON : scaleLocal.y;
+		scaleLocal.z = (scaleLocal.z == 0.0f) ? M_EPSILON : scaleLocal.z;
 
-		UpdateTransform();
+		m_store->SetScaleLocal(m_storeSlot, scaleLocal);
 	}
 	//================================================================================================
 
@@ -178,11 +176,11 @@ namespace Directus
 	{
 		if (!HasParent())
 		{
-			SetPositionLocal(m_positionLocal + delta);
+			SetPositionLocal(GetPositionLocal() + delta);
 		}
 		else
 		{
-			SetPositionLocal(m_positionLocal + GetParent()->GetWorldTransform().Inverted() * delta);
+			SetPositionLocal(GetPositionLocal() + GetParent()->GetWorldTransform().Inverted() * delta);
 		}
 	}
 
@@ -191,12 +189,12 @@ namespace Directus
 		if (!HasParent())
 			RotateLocal(delta);
 		
-		SetRotationLocal(m_rotationLocal * GetRotation().Inverse() * delta * GetRotation());
+		SetRotationLocal(GetRotationLocal() * GetRotation().Inverse() * delta * GetRotation());
 	}
 
 	void Transform::RotateLocal(const Quaternion& delta)
 	{
-		SetRotationLocal((m_rotationLocal * delta).Normalized());
+		SetRotationLocal((GetRotationLocal() * delta).Normalized());
 	}
 
 	Vector3 Transform::GetUp()
@@ -219,9 +217,6 @@ namespace Directus
 	// Sets a parent for this transform
 	void Transform::SetParent(Transform* newParent)
 	{
-		// This is the most complex function 
-		// in this script, tweak it with great caution.
-
 		// if the new parent is null, it means that this should become a root transform
 		if (!newParent)
 		{
@@ -240,45 +235,17 @@ namespace Directus
 				return;
 		}
 
-		// if the new parent is a descendant of this transform
+		// if the new parent is a descendant of this transform, assign the parent
+		// of this transform to the children (or make them orphans if there is none)
 		if (newParent->IsDescendantOf(this))
 		{
-			// if this transform already has a parent
-			if (this->HasParent())
-			{
-				// assign the parent of this transform to the children
-				for (const auto& child : m_children)
-				{
-					child->SetParent(GetParent());
-				}
-			}
-			else // if this transform doesn't have a parent
+			while (m_firstChild)
 			{
-				// make the children orphans
-				for (const auto& child : m_children)
-				{
-					child->BecomeOrphan();
-				}
+				m_firstChild->SetParent(m_parent);
 			}
 		}
 
-		// Make this transform an orphan, this will also cause the 
-		// parent to "forget" about this transform/child
-		if (HasParent())
-		{
-			m_parent->ResolveChildrenRecursively();
-		}
-
-		// save the new parent as the current parent
-		m_parent = newParent;
-
-		// make the new parent "aware" of this transform/child
-		if (m_parent)
-		{
-			m_parent->ResolveChildrenRecursively();
-		}
-
-		UpdateTransform();
+		LinkToParent(newParent);
 	}
 
 	void Transform::AddChild(Transform* child)
@@ -308,12 +275,18 @@ namespace Directus
 			return nullptr;
 		}
 
-		return m_children[index];
+		Transform* child = m_firstChild;
+		for (int i = 0; i < index; i++)
+		{
+			child = child->m_nextSibling;
+		}
+
+		return child;
 	}
 
 	Transform* Transform::GetChildByName(const string& name)
 	{
-		for (const auto& child : m_children)
+		for (Transform* child = m_firstChild; child; child = child->m_nextSibling)
 		{
 			if (child->GetActorName() == name)
 				return child;
@@ -322,47 +295,24 @@ namespace Directus
 		return nullptr;
 	}
 
-	// Searches the entiry hierarchy, finds any children and saves them in m_children.
-	// This is a recursive function, the children will also find their own children and so on...
-	void Transform::ResolveChildrenRecursively()
+	vector<Transform*> Transform::GetChildren()
 	{
-		m_children.clear();
-		m_children.shrink_to_fit();
-
-		auto actors = GetContext()->GetSubsystem<Scene>()->GetAllActors();
-		for (const auto& actor : actors)
+		vector<Transform*> children;
+		children.reserve(m_childrenCount);
+		for (Transform* child = m_firstChild; child; child = child->m_nextSibling)
 		{
-			if (!actor)
-				continue;
-
-			// get the possible child
-			Transform* possibleChild = actor->GetTransform_PtrRaw();
-
-			// if it doesn't have a parent, forget about it.
-			if (!possibleChild->HasParent())
-				continue;
-
-			// if it's parent matches this transform
-			if (possibleChild->GetParent()->GetID() == m_ID)
-			{
-				// welcome home son
-				m_children.push_back(possibleChild);
-
-				// make the child do the same thing all over, essentialy
-				// resolving the entire hierarchy.
-				possibleChild->ResolveChildrenRecursively();
-			}
+			children.push_back(child);
 		}
+
+		return children;
 	}
 
 	bool Transform::IsDescendantOf(Transform* transform)
 	{
-		vector<Transform*> descendants;
-		transform->GetDescendants(&descendants);
-
-		for (const auto& descendant : descendants)
+		// Walk up the hierarchy, that's O(depth) instead of gathering all the descendants
+		for (Transform* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent)
 		{
-			if (descendant->GetID() == m_ID)
+			if (ancestor->GetID() == transform->GetID())
 				return true;
 		}
 
@@ -372,18 +322,13 @@ namespace Directus
 	void Transform::GetDescendants(vector<Transform*>* descendants)
 	{
 		// Depth first acquisition of descendants
-		for (const auto& child : m_children)
+		for (Transform* child = m_firstChild; child; child = child->m_nextSibling)
 		{
 			descendants->push_back(child);
 			child->GetDescendants(descendants);
 		}
 	}
 
-	Matrix Transform::GetParentTransformMatrix()
-	{
-		return HasParent() ? GetParent()->GetWorldTransform() : Matrix::Identity;
-	}
-
 	// Makes this transform have no parent
 	void Transform::BecomeOrphan()
 	{
@@ -391,21 +336,47 @@ namespace Directus
 		if (!m_parent)
 			return;
 
-		// create a temporary reference to the parent
-		Transform* tempRef = m_parent;
-
-		// delete the original reference
-		m_parent = nullptr;
+		LinkToParent(nullptr);
+	}
 
-		// Update the transform without the parent now
-		UpdateTransform();
+	void Transform::LinkToParent(Transform* newParent)
+	{
+		UnlinkFromParent();
 
-		// make the parent search for children,
-		// that's indirect way of making tha parent "forget"
-		// about this child, since it won't be able to find it
-		if (tempRef)
+		m_parent = newParent;
+		if (m_parent)
 		{
-			tempRef->ResolveChildrenRecursively();
+			// Append to the parent's children
+			m_prevSibling = m_parent->m_lastChild;
+			if (m_prevSibling)
+			{
+				m_prevSibling->m_nextSibling = this;
+			}
+			else
+			{
+				m_parent->m_firstChild = this;
+			}
+			m_parent->m_lastChild = this;
+			m_parent->m_childrenCount++;
 		}
+
+		m_store->SetParent(m_storeSlot, m_parent ? (int)m_parent->m_storeSlot : -1);
+	}
+
+	void Transform::UnlinkFromParent()
+	{
+		if (!m_parent)
+			return;
+
+		if (m_prevSibling)	{ m_prevSibling->m_nextSibling = m_nextSibling; }
+		else				{ m_parent->m_firstChild = m_nextSibling; }
+
+		if (m_nextSibling)	{ m_nextSibling->m_prevSibling = m_prevSibling; }
+		else				{ m_parent->m_lastChild = m_prevSibling; }
+
+		m_parent->m_childrenCount--;
+		m_parent		= nullptr;
+		m_prevSibling	= nullptr;
+		m_nextSibling	= nullptr;
 	}
 }
\ No newline at end of file
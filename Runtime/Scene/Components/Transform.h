@@ -28,6 +28,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../../Math/Quaternion.h"
 #include "../../Math/Matrix.h"
 #include "../Scene.h"
+#include "../TransformStore.h"
 //================================
 
 namespace Directus
@@ -47,22 +48,22 @@ namespace Directus
 		void UpdateTransform();
 
 		//= POSITION ============================================================
-		Math::Vector3 GetPosition() { return m_worldTransform.GetTranslation(); }
-		const Math::Vector3& GetPositionLocal() { return m_positionLocal; }
+		Math::Vector3 GetPosition() { return GetWorldTransform().GetTranslation(); }
+		const Math::Vector3& GetPositionLocal() { return m_store->GetPositionLocal(m_storeSlot); }
 		void SetPosition(const Math::Vector3& position);
 		void SetPositionLocal(const Math::Vector3& position);
 		//=======================================================================
 
 		//= ROTATION ============================================================
-		Math::Quaternion GetRotation() { return m_worldTransform.GetRotation(); }
-		const Math::Quaternion& GetRotationLocal() { return m_rotationLocal; }
+		Math::Quaternion GetRotation() { return GetWorldTransform().GetRotation(); }
+		const Math::Quaternion& GetRotationLocal() { return m_store->GetRotationLocal(m_storeSlot); }
 		void SetRotation(const Math::Quaternion& rotation);
 		void SetRotationLocal(const Math::Quaternion& rotation);
 		//=======================================================================
 
 		//= SCALE ======================================================
-		Math::Vector3 GetScale() { return m_worldTransform.GetScale(); }
-		const Math::Vector3& GetScaleLocal() { return m_scaleLocal; }
+		Math::Vector3 GetScale() { return GetWorldTransform().GetScale(); }
+		const Math::Vector3& GetScaleLocal() { return m_store->GetScaleLocal(m_storeSlot); }
 		void SetScale(const Math::Vector3& scale);
 		void SetScaleLocal(const Math::Vector3& scale);
 		//==============================================================
@@ -90,31 +91,40 @@ namespace Directus
 		Transform* GetParent() { return m_parent; }
 		Transform* GetChildByIndex(int index);
 		Transform* GetChildByName(const std::string& name);
-		const std::vector<Transform*>& GetChildren() { return m_children; }
-		int GetChildrenCount() { return (int)m_children.size(); }
-		void ResolveChildrenRecursively();
+		std::vector<Transform*> GetChildren();
+		int GetChildrenCount() { return m_childrenCount; }
+		Transform* GetFirstChild() { return m_firstChild; }
+		Transform* GetNextSibling() { return m_nextSibling; }
 		bool IsDescendantOf(Transform* transform);
 		void GetDescendants(std::vector<Transform*>* descendants);
 		//==========================================================================
 
 		void LookAt(const Math::Vector3& v) { m_lookAt = v; }
-		Math::Matrix& GetWorldTransform() { return m_worldTransform; }
-		Math::Matrix& GetLocalTransform() { return m_localTransform; }
+		const Math::Matrix& GetWorldTransform() { return m_store->GetWorld(m_storeSlot); }
+		const Math::Matrix& GetLocalTransform() { return m_store->GetLocal(m_storeSlot); }
 
 	private:
-		// local
-		Math::Vector3 m_positionLocal;
-		Math::Quaternion m_rotationLocal;
-		Math::Vector3 m_scaleLocal;
+		friend class TransformStore;
 
-		Math::Matrix m_worldTransform;
-		Math::Matrix m_localTransform;
+		// The local TRS and the matrices live in the scene's transform store
+		TransformStore* m_store;
+		unsigned int m_storeSlot;
 		Math::Vector3 m_lookAt;
 
-		Transform* m_parent; // the parent of this transform
-		std::vector<Transform*> m_children; // the children of this transform
+		//= HIERARCHY ============================================================
+		// Intrusive links, so that (re)parenting never has to search the scene
+		Transform* m_parent;		// the parent of this transform
+		Transform* m_firstChild;
+		Transform* m_lastChild;		// children are kept in the order they were added
+		Transform* m_prevSibling;
+		Transform* m_nextSibling;
+		int m_childrenCount;
+		//========================================================================
+
+		//= HELPER FUNCTIONS ===================
+		void LinkToParent(Transform* newParent);
+		void UnlinkFromParent();
+		//======================================
 
-		//= HELPER FUNCTIONS ================================================================
-		Math::Matrix GetParentTransformMatrix();
 	};
 }
\ No newline at end of file
@@ -20,13 +20,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
 //= INCLUDES ==========================================
+#include <algorithm>
 #include "Scene.h"
 #include "Actor.h"
+#include "TransformStore.h"
+#include "AABBTree.h"
+#include "ComponentPool.h"
 #include "Components/Transform.h"
 #include "Components/Camera.h"
 #include "Components/Light.h"
 #include "Components/Script.h"
-#include "Components/LineRenderer.h"
 #include "Components/Skybox.h"
 #include "Components/Renderable.h"
 #include "Components/AudioListener.h"
@@ -44,6 +47,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../FileSystem/FileSystem.h"
 #include "../Logging/Log.h"
 #include "../Profiling/Profiler.h"
+#include "../Threading/Threading.h"
 //=====================================================
 
 //= NAMESPACES ================
@@ -53,15 +57,38 @@ using namespace Directus::Math;
 
 namespace Directus
 {
+	// Gameplay first, then physics, then everything that reads the resulting transforms
+	static const ComponentType g_updateOrder[] =
+	{
+		ComponentType_Script,
+		ComponentType_RigidBody,
+		ComponentType_Collider,
+		ComponentType_Constraint,
+		ComponentType_Transform,
+		ComponentType_Camera,
+		ComponentType_Skybox,
+		ComponentType_Light,
+		ComponentType_Renderable,
+		ComponentType_LineRenderer,
+		ComponentType_AudioListener,
+		ComponentType_AudioSource
+	};
+
 	Scene::Scene(Context* context) : Subsystem(context)
 	{
 		m_ambientLight = Vector3::Zero;
 		m_fps = 0.0f;
 		m_timePassed = 0.0f;
 		m_frameCount = 0;
+		m_isDirty = true;
+		m_transformStore = make_unique<TransformStore>(m_context->GetSubsystem<Threading>());
+		m_spatialIndex = make_unique<AABBTree>();
+		for (auto& pool : m_componentPools)
+		{
+			pool = make_unique<ComponentPool>();
+		}
 
-		SUBSCRIBE_TO_EVENT(EVENT_SCENE_RESOLVE, EVENT_HANDLER(Resolve));
-		SUBSCRIBE_TO_EVENT(EVENT_UPDATE, EVENT_HANDLER(Update));
+		SUBSCRIBE_TO_EVENT(EVENT_SCENE_RESOLVE, EVENT_HANDLER(Resolve_Request));
 	}
 
 	Scene::~Scene()
@@ -71,7 +98,7 @@ namespace Directus
 
 	bool Scene::Initialize()
 	{
-		m_mainCamera = CreateCamera();
+		m_mainCamera = CreateCamera().lock()->GetHandle();
 		CreateSkybox();
 		CreateDirectionalLight();
 		Resolve();
@@ -113,9 +140,10 @@ namespace Directus
 		//=============================================================
 		m_isInEditorMode = !Engine::EngineMode_IsSet(Engine_Game);
 
-		for (const auto& actor : m_actors)
+		// Update one component type at a time
+		for (const auto& type : g_updateOrder)
 		{
-			actor->Update();
+			m_componentPools[type]->Update();
 		}
 
 		ComputeFPS();
@@ -125,11 +153,15 @@ namespace Directus
 
 	void Scene::Clear()
 	{
+		for (const auto& actor : m_actors)
+		{
+			Actor_ReleaseHandle(actor.get());
+		}
 		m_actors.clear();
 		m_actors.shrink_to_fit();
-
-		m_renderables.clear();
-		m_renderables.shrink_to_fit();
+		m_actorSlots.clear();
+		m_actorNames.clear();
+		m_isDirty = true;
 
 		FIRE_EVENT(EVENT_SCENE_CLEARED);
 	}
@@ -164,7 +196,11 @@ namespace Directus
 
 		//= Save actors ============================
 		// Only save root actors as they will also save their descendants
-		vector<weak_ptr<Actor>> rootactors = GetRootActors();
+		vector<Actor*> rootactors;
+		for (const auto& handle : GetRootActors())
+		{
+			rootactors.emplace_back(GetActor(handle));
+		}
 
 		// 1st - actor count
 		auto rootactorCount = (int)rootactors.size();
@@ -173,13 +209,13 @@ namespace Directus
 		// 2nd - actor IDs
 		for (const auto& root : rootactors)
 		{
-			file->Write(root.lock()->GetID());
+			file->Write(root->GetID());
 		}
 
 		// 3rd - actors
 		for (const auto& root : rootactors)
 		{
-			root.lock()->Serialize(file.get());
+			root->Serialize(file.get());
 		}
 		//==============================================
 
@@ -199,6 +235,7 @@ namespace Directus
 			return false;
 		}
 
+		auto loading = Loading_Lock();
 		Clear(); 
 		ProgressReport::Get().Reset(g_progress_Scene);
 		ProgressReport::Get().SetStatus(g_progress_Scene, "Loading scene...");
@@ -215,27 +252,61 @@ namespace Directus
 
 		ProgressReport::Get().SetJobCount(g_progress_Scene, (int)resourcePaths.size());
 
-		// Load all the resources
-		auto resourceMng = m_context->GetSubsystem<ResourceManager>();
+		// Load all the resources, in parallel. Textures go first so that materials find them cached
+		// (still loading) and reference them, rather than loading them themselves.
+		auto resourceMng	= m_context->GetSubsystem<ResourceManager>();
+		auto threading		= m_context->GetSubsystem<Threading>();
+		vector<shared_ptr<IResource>> loadsTextures;
+		vector<shared_ptr<IResource>> loadsOther;
 		for (const auto& resourcePath : resourcePaths)
 		{
-			if (FileSystem::IsEngineModelFile(resourcePath))
+			if (FileSystem::IsEngineTextureFile(resourcePath))
 			{
-				resourceMng->Load<Model>(resourcePath);
+				loadsTextures.emplace_back(resourceMng->LoadAsync<RHI_Texture>(resourcePath).lock());
 			}
+		}
 
-			if (FileSystem::IsEngineMaterialFile(resourcePath))
+		for (const auto& resourcePath : resourcePaths)
+		{
+			if (FileSystem::IsEngineModelFile(resourcePath))
 			{
-				resourceMng->Load<Material>(resourcePath);
+				loadsOther.emplace_back(resourceMng->LoadAsync<Model>(resourcePath).lock());
 			}
+			else if (FileSystem::IsEngineMaterialFile(resourcePath))
+			{
+				loadsOther.emplace_back(resourceMng->LoadAsync<Material>(resourcePath).lock());
+			}
+			else if (!FileSystem::IsEngineTextureFile(resourcePath))
+			{
+				ProgressReport::Get().JobDone(g_progress_Scene);
+			}
+		}
 
-			if (FileSystem::IsEngineTextureFile(resourcePath))
+		// Reports the loads which have completed, this thread helps with the loading while it waits
+		auto loadsWait = [threading, resourceMng](vector<shared_ptr<IResource>>& loads)
+		{
+			while (!loads.empty())
 			{
-				resourceMng->Load<RHI_Texture>(resourcePath);
+				auto completed = remove_if(loads.begin(), loads.end(), [](const shared_ptr<IResource>& resource)
+				{
+					return !resource || resource->GetLoadState() != LoadState_Started;
+				});
+				for (auto it = completed; it != loads.end(); ++it)
+				{
+					ProgressReport::Get().JobDone(g_progress_Scene);
+				}
+				loads.erase(completed, loads.end());
+
+				if (!loads.empty() && !threading->ExecuteOne(resourceMng->GetLoadTasks()))
+				{
+					this_thread::yield();
+				}
 			}
+		};
 
-			ProgressReport::Get().JobDone(g_progress_Scene);
-		}
+		// Actors refer to models and materials by name, which they only get once they have loaded.
+		// Textures keep decoding while the actors are deserialized.
+		loadsWait(loadsOther);
 
 		//= Load actors ============================	
 		// 1st - Root actor count
@@ -259,7 +330,9 @@ namespace Directus
 		}
 		//==============================================
 
-		Resolve();
+		loadsWait(loadsTextures);
+
+		Resolve_Request();
 		ProgressReport::Get().SetIsLoading(g_progress_Scene, false);
 		LOG_INFO("Scene: Loading took " + to_string((int)timer.GetElapsedTimeMs()) + " ms");	
 		FIRE_EVENT(EVENT_SCENE_LOADED);
@@ -276,6 +349,7 @@ namespace Directus
 		// First keep a local reference to this actor because 
 		// as the Transform (added below) will call us back to get a reference to it
 		m_actors.emplace_back(actor);
+		Actor_Index(actor);
 
 		actor->Initialize(actor->AddComponent<Transform>().lock().get());
 
@@ -288,62 +362,39 @@ namespace Directus
 			return;
 
 		m_actors.emplace_back(actor);
+		Actor_Index(actor);
 	}
 
 	bool Scene::Actor_Exists(const weak_ptr<Actor>& actor)
 	{
-		if (actor.expired())
-			return false;
-
-		return !GetActorByID(actor.lock()->GetID()).expired();
+		auto actorShared = actor.lock();
+		return actorShared && GetActor(actorShared->GetHandle()) == actorShared.get();
 	}
 
 	// Removes an actor and all of it's children
 	void Scene::Actor_Remove(const weak_ptr<Actor>& actor)
 	{
-		Actor* actorPtr = actor.lock().get();
-		if (!actorPtr)
+		// Keep the actor alive until the whole subtree is gone
+		shared_ptr<Actor> actorShared = actor.lock();
+		if (!actorShared)
 			return;
 
-		// remove any descendants
-		vector<Transform*> children = actorPtr->GetTransform_PtrRaw()->GetChildren();
-		for (const auto& child : children)
-		{
-			Actor_Remove(child->Getactor_PtrWeak());
-		}
-
-		// Keep a reference to it's parent (in case it has one)
-		Transform* parent = actorPtr->GetTransform_PtrRaw()->GetParent();
+		// Make the parent forget about it
+		actorShared->GetTransform_PtrRaw()->BecomeOrphan();
 
-		// Remove this actor
-		for (auto it = m_actors.begin(); it < m_actors.end();)
-		{
-			shared_ptr<Actor> temp = *it;
-			if (temp->GetID() == actorPtr->GetID())
-			{
-				it = m_actors.erase(it);
-				break;
-			}
-			++it;
-		}
+		Actor_RemoveRecursively(actorShared.get());
 
-		// If there was a parent, update it
-		if (parent)
-		{
-			parent->ResolveChildrenRecursively();
-		}
-
-		Resolve();
+		Resolve_Request();
 	}
 
-	vector<weak_ptr<Actor>> Scene::GetRootActors()
+	vector<ActorHandle> Scene::GetRootActors()
 	{
-		vector<weak_ptr<Actor>> rootactors;
+		vector<ActorHandle> rootactors;
 		for (const auto& actor : m_actors)
 		{
 			if (actor->GetTransform_PtrRaw()->IsRoot())
 			{
-				rootactors.emplace_back(actor);
+				rootactors.emplace_back(actor->GetHandle());
 			}
 		}
 
@@ -360,67 +411,191 @@ namespace Directus
 
 	weak_ptr<Actor> Scene::GetActorByName(const string& name)
 	{
-		for (const auto& actor : m_actors)
+		auto it = m_actorNames.find(name);
+		return it != m_actorNames.end() ? GetActorByID(it->second) : weak_ptr<Actor>();
+	}
+
+	weak_ptr<Actor> Scene::GetActorByID(unsigned int ID)
+	{
+		auto it = m_actorSlots.find(ID);
+		return it != m_actorSlots.end() ? m_actors[it->second] : weak_ptr<Actor>();
+	}
+
+	void Scene::Actor_OnIDChanged(Actor* actor, unsigned int previousID)
+	{
+		auto it = m_actorSlots.find(previousID);
+		if (it == m_actorSlots.end() || m_actors[it->second].get() != actor)
+			return;
+
+		unsigned int slot = it->second;
+		m_actorSlots.erase(it);
+		m_actorSlots[actor->GetID()] = slot;
+
+		auto range = m_actorNames.equal_range(actor->GetName());
+		for (auto name = range.first; name != range.second; ++name)
 		{
-			if (actor->GetName() == name)
+			if (name->second == previousID)
 			{
-				return actor;
+				name->second = actor->GetID();
+				break;
 			}
 		}
+	}
 
-		return weak_ptr<Actor>();
+	void Scene::Actor_OnNameChanged(Actor* actor, const string& previousName)
+	{
+		auto it = m_actorSlots.find(actor->GetID());
+		if (it == m_actorSlots.end() || m_actors[it->second].get() != actor)
+			return;
+
+		auto range = m_actorNames.equal_range(previousName);
+		for (auto name = range.first; name != range.second; ++name)
+		{
+			if (name->second == actor->GetID())
+			{
+				m_actorNames.erase(name);
+				break;
+			}
+		}
+		m_actorNames.emplace(actor->GetName(), actor->GetID());
 	}
 
-	weak_ptr<Actor> Scene::GetActorByID(unsigned int ID)
+	void Scene::Actor_Index(const shared_ptr<Actor>& actor)
 	{
-		for (const auto& actor : m_actors)
+		m_actorSlots[actor->GetID()] = (unsigned int)m_actors.size() - 1;
+		m_actorNames.emplace(actor->GetName(), actor->GetID());
+
+		// Hand out a handle, freed slots come back with a newer generation
+		unsigned int index = 0;
+		if (!m_handlesFree.empty())
 		{
-			if (actor->GetID() == ID)
+			index = m_handlesFree.back();
+			m_handlesFree.pop_back();
+		}
+		else
+		{
+			index = (unsigned int)m_handles.size();
+			m_handles.emplace_back(HandleSlot{ nullptr, 1 });
+		}
+		m_handles[index].actor	= actor.get();
+		actor->m_handle			= ActorHandle(index, m_handles[index].generation);
+	}
+
+	void Scene::Actor_ReleaseHandle(Actor* actor)
+	{
+		if (actor->m_handle.IsNull())
+			return;
+
+		// Invalidate any handles to this actor, generation 0 is reserved for null handles
+		HandleSlot& slot	= m_handles[actor->m_handle.index];
+		slot.actor			= nullptr;
+		slot.generation		= slot.generation + 1 != 0 ? slot.generation + 1 : 1;
+		m_handlesFree.emplace_back(actor->m_handle.index);
+		actor->m_handle		= ActorHandle();
+	}
+
+	void Scene::Actor_Unindex(Actor* actor)
+	{
+		auto it = m_actorSlots.find(actor->GetID());
+		if (it == m_actorSlots.end())
+			return;
+
+		unsigned int slot = it->second;
+		m_actorSlots.erase(it);
+
+		// Before the actor goes away (the pop below might release the last reference)
+		Actor_ReleaseHandle(actor);
+
+		auto range = m_actorNames.equal_range(actor->GetName());
+		for (auto name = range.first; name != range.second; ++name)
+		{
+			if (name->second == actor->GetID())
 			{
-				return actor;
+				m_actorNames.erase(name);
+				break;
 			}
 		}
 
-		return weak_ptr<Actor>();
+		// Swap with the last actor and pop
+		if (slot != (unsigned int)m_actors.size() - 1)
+		{
+			m_actors[slot] = move(m_actors.back());
+			m_actorSlots[m_actors[slot]->GetID()] = slot;
+		}
+		m_actors.pop_back();
+	}
+
+	void Scene::Actor_RemoveRecursively(Actor* actor)
+	{
+		// Remove any descendants first, so that no one points to this actor anymore
+		Transform* transform = actor->GetTransform_PtrRaw();
+		while (Transform* child = transform->GetFirstChild())
+		{
+			Actor* childActor = child->Getactor_PtrRaw();
+			child->BecomeOrphan();
+			Actor_RemoveRecursively(childActor);
+		}
+
+		Actor_Unindex(actor);
 	}
 	//===================================================================================================
 
 	//= SCENE RESOLUTION  ===============================================================================
 	void Scene::Resolve()
 	{
-		PROFILE_FUNCTION_BEGIN();
+		// Cleared up front, so that a request made while resolving isn't lost
+		if (!m_isDirty.exchange(false))
+			return;
 
-		m_renderables.clear();
-		m_renderables.shrink_to_fit();
+		PROFILE_FUNCTION_BEGIN();
 
-		for (const auto& actor : m_actors)
+		// The component pools already track every camera, skybox, light and renderable 
+		// as components come and go, so only the main camera and the skybox are picked here.
+		auto pick = [this](ActorHandle& current, ComponentType type)
 		{
-			static bool hasCamera = false;
-			static bool hasSkybox = false;
+			Actor* actor = GetActor(current);
+			if (actor && actor->HasComponent(type))
+				return;
 
-			// Find camera
-			if (actor->HasComponent<Camera>())
+			// Slots are empty for components removed during the pool's update
+			current = ActorHandle();
+			for (IComponent* component : m_componentPools[type]->GetAll())
 			{
-				m_mainCamera = actor;
-				hasCamera = true;
+				if (component)
+				{
+					current = component->Getactor_PtrRaw()->GetHandle();
+					break;
+				}
 			}
+		};
+		pick(m_mainCamera, ComponentType_Camera);
+		pick(m_skybox, ComponentType_Skybox);
 
-			// Find skybox
-			if (actor->HasComponent<Skybox>())
-			{
-				m_skybox = actor;
-				hasSkybox = true;
-			}
+		PROFILE_FUNCTION_END();
+		FIRE_EVENT(EVENT_SCENE_RESOLVED);
+	}
 
-			// Find renderables
-			if (actor->HasComponent<Renderable>() || hasCamera || hasSkybox || actor->HasComponent<Light>())
+	void Scene::SpatialIndex_Update()
+	{
+		// Proxies of renderables which were destroyed since the last update
+		m_spatialIndex->Remove_Pending();
+
+		const auto& changed = m_transformStore->GetChanged();
+		if (changed.empty())
+			return;
+
+		PROFILE_FUNCTION_BEGIN();
+
+		// Static geometry never shows up here, so this only costs as much as what moved
+		for (Transform* transform : changed)
+		{
+			if (Renderable* renderable = transform->Getactor_PtrRaw()->GetRenderable_PtrRaw())
 			{
-				m_renderables.push_back(actor);
+				renderable->Geometry_UpdateSpatialIndex();
 			}
 		}
 
 		PROFILE_FUNCTION_END();
-		FIRE_EVENT_DATA(EVENT_SCENE_RESOLVED, m_renderables);
 	}
 	//===================================================================================================
 
@@ -442,9 +617,8 @@ namespace Directus
 		shared_ptr<Actor> skybox = Actor_CreateAdd().lock();
 		skybox->SetName("Skybox");
 		skybox->SetHierarchyVisibility(false);
-		skybox->AddComponent<LineRenderer>();
 		skybox->AddComponent<Skybox>();	
-		skybox->GetTransform_PtrRaw()->SetParent(m_mainCamera.lock()->GetTransform_PtrRaw());
+		skybox->GetTransform_PtrRaw()->SetParent(GetActor(m_mainCamera)->GetTransform_PtrRaw());
 
 		return skybox;
 	}
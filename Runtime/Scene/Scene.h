@@ -23,14 +23,24 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES ======================
 #include <vector>
+#include <memory>
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
 #include "../Math/Vector3.h"
 #include "../Threading/Threading.h"
+#include "Components/IComponent.h"
+#include "ActorHandle.h"
 //=================================
 
 namespace Directus
 {
 	class Actor;
 	class Light;
+	class TransformStore;
+	class AABBTree;
+	class ComponentPool;
 
 	class ENGINE_CLASS Scene : public Subsystem
 	{
@@ -56,27 +66,51 @@ namespace Directus
 		//= IO ========================================
 		bool SaveToFile(const std::string& filePath);
 		bool LoadFromFile(const std::string& filePath);
-		//=============================================
+		// Held by whoever builds the scene on another thread (scene and model loads). The frame stages
+		// which touch the scene try to get it too, and skip the scene for as long as a load holds it.
+		std::unique_lock<std::mutex> Loading_Lock()		{ return std::unique_lock<std::mutex>(m_loadingMutex); }
+		std::unique_lock<std::mutex> Loading_TryLock()	{ return std::unique_lock<std::mutex>(m_loadingMutex, std::try_to_lock); }
+		//==============================================
 
 		//= actor HELPER FUNCTIONS =============================================================
 		std::weak_ptr<Actor> Actor_CreateAdd();
 		void Actor_Add(std::shared_ptr<Actor> actor);
 		bool Actor_Exists(const std::weak_ptr<Actor>& actor);
+		bool Actor_Exists(const ActorHandle& handle) { return GetActor(handle) != nullptr; }
 		void Actor_Remove(const std::weak_ptr<Actor>& actor);
 		const std::vector<std::shared_ptr<Actor>>& GetAllActors() { return m_actors; }
-		std::vector<std::weak_ptr<Actor>> GetRootActors();
+		std::vector<ActorHandle> GetRootActors();
 		std::weak_ptr<Actor> GetActorRoot(std::weak_ptr<Actor> actor);
 		std::weak_ptr<Actor> GetActorByName(const std::string& name);
 		std::weak_ptr<Actor> GetActorByID(unsigned int ID);	
+		// Returns the actor a handle refers to, or nullptr if it has been removed
+		Actor* GetActor(const ActorHandle& handle)
+		{
+			if (handle.index >= (unsigned int)m_handles.size() || m_handles[handle.index].generation != handle.generation)
+				return nullptr;
+
+			return m_handles[handle.index].actor;
+		}
 		int GetactorCount() { return (int)m_actors.size(); }
+		// Called by actors when their ID or name changes, so that the lookups stay in sync
+		void Actor_OnIDChanged(Actor* actor, unsigned int previousID);
+		void Actor_OnNameChanged(Actor* actor, const std::string& previousName);
 		//===========================================================================================
 
-		//= SCENE RESOLUTION  ==============================
+		//= SCENE RESOLUTION  ===================================================
+		// Resolves the scene, but only if something changed since the last time
 		void Resolve();
-		const std::vector<std::weak_ptr<Actor>>& GetRenderables() { return m_renderables; }
-		std::weak_ptr<Actor> GetMainCamera() { return m_mainCamera; }
+		// Cheap, the actual resolution happens at most once per frame
+		void Resolve_Request() { m_isDirty = true; }
+		const ActorHandle& GetMainCamera() { return m_mainCamera; }
+		// Removes the proxies of destroyed renderables and moves the ones whose transform changed during
+		// the last propagation, within the spatial index. Skipped (with the rest of the scene stage) during loads.
+		void SpatialIndex_Update();
 
 		//= MISC =======================================
+		TransformStore* GetTransformStore() { return m_transformStore.get(); }
+		AABBTree* GetSpatialIndex() { return m_spatialIndex.get(); }
+		ComponentPool* GetComponentPool(ComponentType type) { return m_componentPools[type].get(); }
 		void SetAmbientLight(float x, float y, float z);
 		Math::Vector3 GetAmbientLight();
 
@@ -91,14 +125,38 @@ namespace Directus
 		std::weak_ptr<Actor> CreateDirectionalLight();
 		//============================================
 
+		//= ACTOR INDEX ===================================
+		void Actor_Index(const std::shared_ptr<Actor>& actor);
+		void Actor_Unindex(Actor* actor);
+		void Actor_RemoveRecursively(Actor* actor);
+		void Actor_ReleaseHandle(Actor* actor);
+		//=================================================
+
 		void ComputeFPS(); // TODO: This doesn't belong here
 
+		// Declared first so that they outlive the components of the actors
+		std::unique_ptr<TransformStore> m_transformStore;
+		std::unique_ptr<AABBTree> m_spatialIndex;
+		std::unique_ptr<ComponentPool> m_componentPools[ComponentType_Unknown];
 		std::vector<std::shared_ptr<Actor>> m_actors;
-		std::vector<std::weak_ptr<Actor>> m_renderables;
-
-		std::weak_ptr<Actor> m_mainCamera;
-		std::weak_ptr<Actor> m_skybox;
+		std::unordered_map<unsigned int, unsigned int> m_actorSlots;		// ID -> index in m_actors
+		std::unordered_multimap<std::string, unsigned int> m_actorNames;	// name -> ID
+
+		//= HANDLES ===========================================
+		struct HandleSlot
+		{
+			Actor* actor;
+			unsigned int generation;
+		};
+		std::vector<HandleSlot> m_handles;
+		std::vector<unsigned int> m_handlesFree;
+		//=====================================================
+
+		ActorHandle m_mainCamera;
+		ActorHandle m_skybox;
 		Math::Vector3 m_ambientLight;
+		std::atomic<bool> m_isDirty;	// Requested from any thread
+		std::mutex m_loadingMutex;
 
 		//= STATS ============
 		float m_fps;
@@ -0,0 +1,273 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ========================
+#include "TransformStore.h"
+#include "Components/Transform.h"
+#include "../Threading/Threading.h"
+#include "../Profiling/Profiler.h"
+//===================================
+
+//= NAMESPACES ================
+using namespace std;
+using namespace Directus::Math;
+//=============================
+
+// Nodes per task, a level smaller than this is propagated by the calling thread alone
+static const unsigned int PROPAGATION_GRAIN = 256;
+
+namespace Directus
+{
+	TransformStore::TransformStore(Threading* threading)
+	{
+		m_threading		= threading;
+		m_dirtyCount	= 0;
+		m_sorted		= true;
+	}
+
+	unsigned int TransformStore::Add(Transform* owner)
+	{
+		m_positionLocal.emplace_back(Vector3::Zero);
+		m_rotationLocal.emplace_back(Quaternion(0, 0, 0, 1));
+		m_scaleLocal.emplace_back(Vector3::One);
+		m_local.emplace_back(Matrix::Identity);
+		m_world.emplace_back(Matrix::Identity);
+		m_parent.emplace_back(-1);
+		m_dirty.emplace_back(1);
+		m_owner.emplace_back(owner);
+
+		m_dirtyCount++;
+		m_sorted = false;
+
+		return (unsigned int)m_owner.size() - 1;
+	}
+
+	void TransformStore::Remove(unsigned int slot)
+	{
+		// The slot is reclaimed by the next Sort(), children pointing to it become roots
+		m_owner[slot]	= nullptr;
+		m_parent[slot]	= -1;
+		m_dirty[slot]	= 0;
+		m_sorted		= false;
+	}
+
+	void TransformStore::SetParent(unsigned int slot, int parentSlot)
+	{
+		if (m_parent[slot] == parentSlot)
+			return;
+
+		m_parent[slot]	= parentSlot;
+		m_sorted		= false;
+		MarkDirty(slot);
+	}
+
+	const Matrix& TransformStore::GetLocal(unsigned int slot)
+	{
+		if (m_dirty[slot])
+		{
+			m_local[slot] = Matrix(m_positionLocal[slot], m_rotationLocal[slot], m_scaleLocal[slot]);
+		}
+
+		return m_local[slot];
+	}
+
+	const Matrix& TransformStore::GetWorld(unsigned int slot)
+	{
+		// Nothing has changed since the last propagation
+		if (m_dirtyCount == 0)
+			return m_world[slot];
+
+		// Find the top-most dirty node on the way to the root
+		int top = -1;
+		for (int i = (int)slot; i != -1; i = m_parent[i])
+		{
+			if (m_dirty[i]) top = i;
+		}
+
+		// Only this chain is computed, the rest of the hierarchy waits for Update()
+		if (top != -1)
+		{
+			ComputeChain(slot, (unsigned int)top);
+		}
+
+		return m_world[slot];
+	}
+
+	void TransformStore::Update()
+	{
+		m_changed.clear();
+
+		if (!m_sorted)
+		{
+			Sort();
+		}
+
+		if (m_dirtyCount == 0)
+			return;
+
+		PROFILE_FUNCTION_BEGIN();
+
+		// Parents live in earlier levels, so by the time a level is processed, its parents are final
+		for (unsigned int level = 0; level + 1 < (unsigned int)m_levels.size(); level++)
+		{
+			m_threading->ParallelForRange(m_levels[level], m_levels[level + 1], PROPAGATION_GRAIN, [this](unsigned int begin, unsigned int end)
+			{
+				for (unsigned int i = begin; i < end; i++)
+				{
+					int parent			= m_parent[i];
+					bool parentChanged	= parent != -1 && m_dirty[parent];
+					if (!m_dirty[i] && !parentChanged)
+						continue;
+
+					ComputeNode(i, m_dirty[i] != 0);
+					m_dirty[i] = 1; // Let the children know
+				}
+			});
+		}
+
+		for (unsigned int i = 0; i < (unsigned int)m_dirty.size(); i++)
+		{
+			if (m_dirty[i]) m_changed.emplace_back(m_owner[i]);
+		}
+		fill(m_dirty.begin(), m_dirty.end(), (unsigned char)0);
+		m_dirtyCount = 0;
+
+		PROFILE_FUNCTION_END();
+	}
+
+	void TransformStore::Sort()
+	{
+		unsigned int count = (unsigned int)m_owner.size();
+
+		// Compute the depth of every node (a removed parent makes a node a root)
+		vector<int> depth(count, -1);
+		int maxDepth = -1;
+		for (unsigned int i = 0; i < count; i++)
+		{
+			if (!m_owner[i])
+				continue;
+
+			// Walk up until a node with a known depth
+			int steps = 0;
+			int node = (int)i;
+			while (node != -1 && depth[node] == -1)
+			{
+				int parent = m_parent[node];
+				if (parent != -1 && !m_owner[parent])
+				{
+					m_parent[node]	= -1;
+					m_dirty[node]	= 1;
+					parent			= -1;
+				}
+				node = parent;
+				steps++;
+			}
+			int base = node == -1 ? -1 : depth[node];
+
+			// Walk again, assigning depths top-down
+			node = (int)i;
+			for (int step = steps; step > 0; step--)
+			{
+				depth[node] = base + step;
+				maxDepth	= Max(maxDepth, depth[node]);
+				node		= m_parent[node];
+			}
+		}
+
+		// Counting sort by depth, stable so that siblings keep their order
+		m_levels.assign(maxDepth + 2, 0);
+		for (unsigned int i = 0; i < count; i++)
+		{
+			if (depth[i] != -1) m_levels[depth[i] + 1]++;
+		}
+		for (unsigned int level = 1; level < (unsigned int)m_levels.size(); level++)
+		{
+			m_levels[level] += m_levels[level - 1];
+		}
+
+		vector<int> remap(count, -1);
+		vector<unsigned int> cursor(m_levels.begin(), m_levels.end() - 1);
+		for (unsigned int i = 0; i < count; i++)
+		{
+			if (depth[i] != -1) remap[i] = (int)cursor[depth[i]]++;
+		}
+
+		// Permute
+		unsigned int liveCount = m_levels.back();
+		vector<Vector3> positionLocal(liveCount);
+		vector<Quaternion> rotationLocal(liveCount);
+		vector<Vector3> scaleLocal(liveCount);
+		vector<Matrix> local(liveCount);
+		vector<Matrix> world(liveCount);
+		vector<int> parent(liveCount);
+		vector<unsigned char> dirty(liveCount);
+		vector<Transform*> owner(liveCount);
+		for (unsigned int i = 0; i < count; i++)
+		{
+			int slot = remap[i];
+			if (slot == -1)
+				continue;
+
+			positionLocal[slot]	= m_positionLocal[i];
+			rotationLocal[slot]	= m_rotationLocal[i];
+			scaleLocal[slot]	= m_scaleLocal[i];
+			local[slot]			= m_local[i];
+			world[slot]			= m_world[i];
+			parent[slot]		= m_parent[i] != -1 ? remap[m_parent[i]] : -1;
+			dirty[slot]			= m_dirty[i];
+			owner[slot]			= m_owner[i];
+			owner[slot]->m_storeSlot = (unsigned int)slot;
+		}
+
+		m_positionLocal.swap(positionLocal);
+		m_rotationLocal.swap(rotationLocal);
+		m_scaleLocal.swap(scaleLocal);
+		m_local.swap(local);
+		m_world.swap(world);
+		m_parent.swap(parent);
+		m_dirty.swap(dirty);
+		m_owner.swap(owner);
+
+		// Orphaned nodes were flagged dirty above
+		m_dirtyCount++;
+		m_sorted = true;
+	}
+
+	void TransformStore::ComputeChain(unsigned int slot, unsigned int top)
+	{
+		if (slot != top)
+		{
+			ComputeChain((unsigned int)m_parent[slot], top);
+		}
+		ComputeNode(slot, true);
+	}
+
+	void TransformStore::ComputeNode(unsigned int slot, bool local)
+	{
+		if (local)
+		{
+			m_local[slot] = Matrix(m_positionLocal[slot], m_rotationLocal[slot], m_scaleLocal[slot]);
+		}
+
+		int parent		= m_parent[slot];
+		m_world[slot]	= parent == -1 ? m_local[slot] : m_local[slot] * m_world[parent];
+	}
+}
@@ -0,0 +1,99 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES =====================
+#include <vector>
+#include "../Core/EngineDefs.h"
+#include "../Math/Vector3.h"
+#include "../Math/Quaternion.h"
+#include "../Math/Matrix.h"
+//================================
+
+namespace Directus
+{
+	class Transform;
+	class Threading;
+
+	// Keeps the local TRS and the matrices of every transform in contiguous arrays, sorted by hierarchy depth.
+	// Setters only mark a node as dirty, Update() then propagates all the changes in one (parallel) pass per frame.
+	class ENGINE_CLASS TransformStore
+	{
+	public:
+		TransformStore(Threading* threading);
+		~TransformStore() {}
+
+		//= SLOTS ====================================================
+		unsigned int Add(Transform* owner);
+		void Remove(unsigned int slot);
+		// A parent slot of -1 makes the transform a root
+		void SetParent(unsigned int slot, int parentSlot);
+		unsigned int GetCount() { return (unsigned int)m_owner.size(); }
+		//============================================================
+
+		//= LOCAL ==========================================================================================================
+		const Math::Vector3& GetPositionLocal(unsigned int slot)		{ return m_positionLocal[slot]; }
+		const Math::Quaternion& GetRotationLocal(unsigned int slot)		{ return m_rotationLocal[slot]; }
+		const Math::Vector3& GetScaleLocal(unsigned int slot)			{ return m_scaleLocal[slot]; }
+		void SetPositionLocal(unsigned int slot, const Math::Vector3& position)		{ m_positionLocal[slot] = position; MarkDirty(slot); }
+		void SetRotationLocal(unsigned int slot, const Math::Quaternion& rotation)	{ m_rotationLocal[slot] = rotation; MarkDirty(slot); }
+		void SetScaleLocal(unsigned int slot, const Math::Vector3& scale)			{ m_scaleLocal[slot] = scale;		MarkDirty(slot); }
+		//==================================================================================================================
+
+		//= MATRICES ===========================================================================
+		// If the transform (or any of its ancestors) is dirty, its chain is computed on the spot
+		const Math::Matrix& GetLocal(unsigned int slot);
+		const Math::Matrix& GetWorld(unsigned int slot);
+		// The world matrix of the transform and its descendants will be re-computed by Update()
+		void MarkDirty(unsigned int slot) { m_dirty[slot] = 1; m_dirtyCount++; }
+		//======================================================================================
+
+		// Propagates every change since the last call, level by level
+		void Update();
+		// The transforms whose world matrix changed during the last Update()
+		const std::vector<Transform*>& GetChanged() { return m_changed; }
+
+	private:
+		void Sort();
+		void ComputeChain(unsigned int slot, unsigned int top);
+		void ComputeNode(unsigned int slot, bool local);
+
+		//= SOA ====================================
+		std::vector<Math::Vector3> m_positionLocal;
+		std::vector<Math::Quaternion> m_rotationLocal;
+		std::vector<Math::Vector3> m_scaleLocal;
+		std::vector<Math::Matrix> m_local;
+		std::vector<Math::Matrix> m_world;
+		std::vector<int> m_parent;
+		std::vector<unsigned char> m_dirty;
+		std::vector<Transform*> m_owner; // null for removed slots
+		//==========================================
+
+		std::vector<Transform*> m_changed;
+
+		// Where each depth level begins (plus the end of the last one), valid while sorted
+		std::vector<unsigned int> m_levels;
+		unsigned int m_dirtyCount;
+		bool m_sorted;
+		Threading* m_threading;
+	};
+}
\ No newline at end of file
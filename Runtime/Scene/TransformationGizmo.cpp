@@ -55,12 +55,12 @@ namespace Directus
 
 	}
 
-	void TransformationGizmo::Pick(weak_ptr<Actor> actor)
+	void TransformationGizmo::Pick(Actor* actor)
 	{
-		if (actor.expired())
+		if (!actor)
 			return;
 
-		Transform* transformComponent = actor.lock()->GetComponent<Transform>().lock().get();
+		Transform* transformComponent = actor->GetTransform_PtrRaw();
 		Matrix transform = (m_space == TransformGizmo_Local) ? transformComponent->GetWorldTransform() : transformComponent->GetWorldTransform();
 
 		Matrix mTranslation		= Matrix::CreateTranslation(transform.GetTranslation());
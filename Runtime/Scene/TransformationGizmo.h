@@ -51,7 +51,7 @@ namespace Directus
 		TransformationGizmo(Context* context);
 		~TransformationGizmo();
 
-		void Pick(std::weak_ptr<Actor> actor);
+		void Pick(Actor* actor);
 		void SetBuffers();
 		unsigned int GetIndexCount();
 
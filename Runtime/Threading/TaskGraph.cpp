@@ -0,0 +1,147 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ==========
+#include "TaskGraph.h"
+#include "Threading.h"
+//=====================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+namespace Directus
+{
+	TaskGraph::TaskGraph(Threading* threading)
+	{
+		m_threading = threading;
+	}
+
+	TaskGraph::~TaskGraph()
+	{
+		Clear();
+	}
+
+	void TaskGraph::AddStage(const string& name, unsigned long reads, unsigned long writes, bool mainThread, function<void()>&& function)
+	{
+		auto stage			= make_unique<Stage>();
+		stage->name			= name;
+		stage->reads		= reads;
+		stage->writes		= writes;
+		stage->mainThread	= mainThread;
+		stage->function		= std::forward<std::function<void()>>(function);
+
+		// Depend on any previous stage that we conflict with (read after write, write after write, write after read)
+		auto stageIndex = (unsigned int)m_stages.size();
+		for (const auto& previous : m_stages)
+		{
+			bool conflict = (previous->writes & (reads | writes)) || (previous->reads & writes);
+			if (!conflict)
+				continue;
+
+			previous->dependents.emplace_back(stageIndex);
+			stage->dependencyCount++;
+		}
+
+		m_stages.emplace_back(move(stage));
+	}
+
+	void TaskGraph::Execute()
+	{
+		if (m_stages.empty())
+			return;
+
+		// Reset
+		m_stagesCompleted = 0;
+		for (const auto& stage : m_stages)
+		{
+			stage->dependenciesPending = stage->dependencyCount;
+		}
+
+		// Kick off the stages that don't depend on anything
+		for (unsigned int i = 0; i < (unsigned int)m_stages.size(); i++)
+		{
+			if (m_stages[i]->dependencyCount == 0)
+			{
+				Dispatch(i);
+			}
+		}
+
+		// Run main thread stages as they become ready and help with the rest in the meantime (only with
+		// stages, anything else that is queued, e.g. a scene load, could hold up the frame for seconds)
+		auto stageCount = (unsigned int)m_stages.size();
+		while (m_stagesCompleted.load() < stageCount)
+		{
+			unique_lock<mutex> lock(m_mainThreadMutex);
+			if (!m_mainThreadStages.empty())
+			{
+				unsigned int stageIndex = m_mainThreadStages.front();
+				m_mainThreadStages.pop_front();
+				lock.unlock();
+
+				Run(stageIndex);
+				continue;
+			}
+			lock.unlock();
+
+			if (!m_threading->ExecuteOne(m_stageTasks))
+			{
+				this_thread::yield();
+			}
+		}
+	}
+
+	void TaskGraph::Clear()
+	{
+		m_stages.clear();
+		m_stages.shrink_to_fit();
+		m_mainThreadStages.clear();
+	}
+
+	void TaskGraph::Dispatch(unsigned int stageIndex)
+	{
+		if (m_stages[stageIndex]->mainThread)
+		{
+			lock_guard<mutex> lock(m_mainThreadMutex);
+			m_mainThreadStages.emplace_back(stageIndex);
+			return;
+		}
+
+		m_threading->AddTask([this, stageIndex]() { Run(stageIndex); }, m_stageTasks);
+	}
+
+	void TaskGraph::Run(unsigned int stageIndex)
+	{
+		Stage* stage = m_stages[stageIndex].get();
+		stage->function();
+
+		// Release any dependents that were waiting only for this stage
+		for (unsigned int dependent : stage->dependents)
+		{
+			if (m_stages[dependent]->dependenciesPending.fetch_sub(1) == 1)
+			{
+				Dispatch(dependent);
+			}
+		}
+
+		m_stagesCompleted.fetch_add(1);
+	}
+}
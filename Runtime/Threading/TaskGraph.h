@@ -0,0 +1,82 @@
+/*
+Copyright(c) 2016-2018 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES =================
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <functional>
+#include "../Core/EngineDefs.h"
+#include "Threading.h"
+//============================
+
+namespace Directus
+{
+	// A graph of stages which is executed once per frame. Every stage declares the data it reads and
+	// writes (as bit flags). A stage depends on any previously added stage that writes data it reads or
+	// writes, or reads data it writes. Stages without such dependencies run concurrently.
+	class ENGINE_CLASS TaskGraph
+	{
+	public:
+		TaskGraph(Threading* threading);
+		~TaskGraph();
+
+		// Adds a stage. Stages which have to run on the thread that calls Execute() (e.g. 
+		// rendering with an immediate device context) can request to do so via mainThread.
+		void AddStage(const std::string& name, unsigned long reads, unsigned long writes, bool mainThread, std::function<void()>&& function);
+
+		// Executes all the stages, returns when all of them have completed
+		void Execute();
+
+		// Removes all the stages
+		void Clear();
+
+		unsigned int GetStageCount() { return (unsigned int)m_stages.size(); }
+
+	private:
+		struct Stage
+		{
+			std::string name;
+			unsigned long reads		= 0;
+			unsigned long writes	= 0;
+			bool mainThread			= false;
+			std::function<void()> function;
+			std::vector<unsigned int> dependents;
+			unsigned int dependencyCount = 0;
+			std::atomic<unsigned int> dependenciesPending = 0;
+		};
+
+		void Dispatch(unsigned int stageIndex);
+		void Run(unsigned int stageIndex);
+
+		std::vector<std::unique_ptr<Stage>> m_stages;
+		std::deque<unsigned int> m_mainThreadStages;
+		std::mutex m_mainThreadMutex;
+		std::atomic<unsigned int> m_stagesCompleted = 0;
+		TaskHandle m_stageTasks;
+		Threading* m_threading;
+	};
+}
@@ -29,15 +29,22 @@ using namespace  std;
 
 namespace Directus
 {
+	// The index of the worker that owns the calling thread (-1 for non-worker threads)
+	static thread_local int g_workerIndex = -1;
+
 	Threading::Threading(Context* context) : Subsystem(context)
 	{
 		m_stopping = false;
+
+		// Leave one hardware thread for the main thread (which also helps out while waiting)
+		unsigned int hardwareThreads = thread::hardware_concurrency();
+		m_threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
 	}
 
 	Threading::~Threading()
 	{
-		// Put unique lock on task mutex.
-		unique_lock<mutex> lock(m_tasksMutex);
+		// Put unique lock on the sleep mutex.
+		unique_lock<mutex> lock(m_sleepMutex);
 
 		// Set termination flag to true.
 		m_stopping = true;
@@ -56,44 +63,140 @@ namespace Directus
 
 		// Empty worker threads.
 		m_threads.clear();
+		m_queues.clear();
 	}
 
 	bool Threading::Initialize()
 	{
-		for (int i = 0; i < m_threadCount; i++)
+		// Create all the queues first as any worker can steal from any queue
+		for (unsigned int i = 0; i < m_threadCount; i++)
+		{
+			m_queues.emplace_back(make_unique<TaskQueue>());
+		}
+
+		for (unsigned int i = 0; i < m_threadCount; i++)
 		{
-			m_threads.emplace_back(thread(&Threading::Invoke, this));
+			m_threads.emplace_back(thread(&Threading::Invoke, this, i));
 		}
 
 		return true;
 	}
 
-	void Threading::Invoke()
+	void Threading::Invoke(unsigned int workerIndex)
 	{
-		shared_ptr<Task> task;
+		g_workerIndex = (int)workerIndex;
+
+		Task task;
 		while (true)
 		{
-			// Lock tasks mutex
-			unique_lock<mutex> lock(m_tasksMutex);
-
-			// Check condition on notification
-			m_conditionVar.wait(lock, [this] { return !m_tasks.empty() || m_stopping; });
+			// Execute tasks for as long as there are any
+			if (TryGetTask(task, g_workerIndex))
+			{
+				task.Execute();
+				task = Task();
+				continue;
+			}
+
+			// Nothing to do, go to sleep
+			unique_lock<mutex> lock(m_sleepMutex);
+			m_threadsSleeping++;
+			m_conditionVar.wait(lock, [this] { return m_tasksQueued.load() > 0 || m_stopping; });
+			m_threadsSleeping--;
 
 			// If m_stopping is true, it's time to shut everything down
-			if (m_stopping && m_tasks.empty())
+			if (m_stopping && m_tasksQueued.load() <= 0)
 				return;
+		}
+	}
 
-			// Get next task in the queue.
-			task = m_tasks.front();
+	void Threading::Wait(const TaskHandle& handle)
+	{
+		while (!handle.IsComplete())
+		{
+			if (!ExecuteOne(handle))
+			{
+				this_thread::yield();
+			}
+		}
+	}
 
-			// Remove it from the queue.
-			m_tasks.pop();
+	bool Threading::ExecuteOne(const TaskHandle& handle)
+	{
+		Task task;
+		if (!TryGetTask(task, handle.GetCounter().get()))
+			return false;
 
-			// Unlock the mutex
-			lock.unlock();
+		task.Execute();
+		return true;
+	}
 
-			// Execute the task.
-			task->Execute();
+	void Threading::Schedule(Task&& task)
+	{
+		// No workers (not initialized yet), execute immediately
+		if (m_queues.empty())
+		{
+			task.Execute();
+			return;
 		}
+
+		// Workers push to their own queue, any other thread distributes in a round-robin fashion
+		unsigned int queueIndex = g_workerIndex != -1 ? g_workerIndex : m_queueNext.fetch_add(1) % (unsigned int)m_queues.size();
+		m_queues[queueIndex]->Push(move(task));
+		m_tasksQueued.fetch_add(1);
+
+		// Wake up a thread (only if there is one sleeping)
+		if (m_threadsSleeping.load() > 0)
+		{
+			lock_guard<mutex> lock(m_sleepMutex);
+			m_conditionVar.notify_one();
+		}
+	}
+
+	bool Threading::TryGetTask(Task& task, int workerIndex)
+	{
+		if (m_tasksQueued.load() <= 0)
+			return false;
+
+		auto queueCount = (unsigned int)m_queues.size();
+
+		// Try our own queue first
+		if (workerIndex != -1 && m_queues[workerIndex]->Pop(task))
+		{
+			m_tasksQueued.fetch_sub(1);
+			return true;
+		}
+
+		// Steal from the rest of the queues
+		unsigned int start = workerIndex != -1 ? workerIndex + 1 : m_queueNext.load();
+		for (unsigned int i = 0; i < queueCount; i++)
+		{
+			unsigned int index = (start + i) % queueCount;
+			if ((int)index == workerIndex)
+				continue;
+
+			if (m_queues[index]->Steal(task))
+			{
+				m_tasksQueued.fetch_sub(1);
+				return true;
+			}
+		}
+
+		return false;
+	}
+	bool Threading::TryGetTask(Task& task, const TaskCounter* counter)
+	{
+		if (m_tasksQueued.load() <= 0)
+			return false;
+
+		for (const auto& queue : m_queues)
+		{
+			if (queue->Steal(task, counter))
+			{
+				m_tasksQueued.fetch_sub(1);
+				return true;
+			}
+		}
+
+		return false;
 	}
 }
\ No newline at end of file
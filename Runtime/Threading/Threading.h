@@ -23,29 +23,128 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES =================
 #include <vector>
+#include <deque>
 #include <thread>
 #include <mutex>
-#include <queue>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include <condition_variable>
 #include "../Core/SubSystem.h"
 //============================
 
 namespace Directus
 {
 	//= TASK ===============================================================================
+	// Keeps track of how many tasks of a group haven't finished yet
+	class TaskCounter
+	{
+	public:
+		void Increment()	{ m_pending.fetch_add(1); }
+		void Decrement()	{ m_pending.fetch_sub(1); }
+		bool IsComplete()	{ return m_pending.load() == 0; }
+
+	private:
+		std::atomic<int> m_pending = 0;
+	};
+
 	class Task
 	{
 	public:
 		typedef std::function<void()> functionType;
 
-		Task(functionType&& function) { m_function = std::forward<functionType>(function); }
-		void Execute() { m_function(); }
+		Task() = default;
+		Task(functionType&& function, const std::shared_ptr<TaskCounter>& counter)
+		{
+			m_function	= std::forward<functionType>(function);
+			m_counter	= counter;
+		}
+
+		void Execute()
+		{
+			m_function();
+			if (m_counter) m_counter->Decrement();
+		}
+
+		const TaskCounter* GetCounter() const { return m_counter.get(); }
 
 	private:
 		functionType m_function;
+		std::shared_ptr<TaskCounter> m_counter;
+	};
+
+	// A handle to one or more tasks, can be waited on via Threading::Wait()
+	class TaskHandle
+	{
+	public:
+		TaskHandle() { m_counter = std::make_shared<TaskCounter>(); }
+		bool IsComplete() const { return m_counter->IsComplete(); }
+		const std::shared_ptr<TaskCounter>& GetCounter() const { return m_counter; }
+
+	private:
+		std::shared_ptr<TaskCounter> m_counter;
+	};
+
+	// A double ended task queue, owned by a single worker. The owner
+	// pushes and pops from the back while other threads steal from the front.
+	class TaskQueue
+	{
+	public:
+		void Push(Task&& task)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_tasks.emplace_back(std::move(task));
+		}
+
+		bool Pop(Task& task)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_tasks.empty())
+				return false;
+
+			task = std::move(m_tasks.back());
+			m_tasks.pop_back();
+			return true;
+		}
+
+		bool Steal(Task& task)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_tasks.empty())
+				return false;
+
+			task = std::move(m_tasks.front());
+			m_tasks.pop_front();
+			return true;
+		}
+
+		// Steals the oldest task of the given group (counter), skipping any other
+		bool Steal(Task& task, const TaskCounter* counter)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (auto it = m_tasks.begin(); it != m_tasks.end(); ++it)
+			{
+				if (it->GetCounter() != counter)
+					continue;
+
+				task = std::move(*it);
+				m_tasks.erase(it);
+				return true;
+			}
+
+			return false;
+		}
+
+	private:
+		std::deque<Task> m_tasks;
+		std::mutex m_mutex;
 	};
 	//======================================================================================
 
-	class Threading : public Subsystem
+	// Automatic grains don't go below this, smaller ranges run on the calling thread
+	static const unsigned int PARALLEL_MIN_GRAIN = 64;
+
+	class ENGINE_CLASS Threading : public Subsystem
 	{
 	public:
 		Threading(Context* context);
@@ -56,30 +155,128 @@ namespace Directus
 		//========================
 
 		// This function is invoked by the threads
-		void Invoke();
+		void Invoke(unsigned int workerIndex);
+
+		// Add a task, returns a handle which can be waited on
+		template <typename Function>
+		TaskHandle AddTask(Function&& function)
+		{
+			TaskHandle handle;
+			AddTask(std::forward<Function>(function), handle);
+			return handle;
+		}
+
+		// Add a task to an existing handle (useful to wait on a group of tasks)
+		template <typename Function>
+		void AddTask(Function&& function, const TaskHandle& handle)
+		{
+			handle.GetCounter()->Increment();
+			Schedule(Task(std::bind(std::forward<Function>(function)), handle.GetCounter()));
+		}
+
+		// Blocks until all the tasks of the handle have completed. Instead of idling, the calling thread
+		// executes pending tasks of the handle (never unrelated ones, which might be long loads).
+		void Wait(const TaskHandle& handle);
+
+		// Executes a single pending task of the handle on the calling thread, returns false if there was none
+		bool ExecuteOne(const TaskHandle& handle);
+
+		//= PARALLEL RANGES ======================================================================================
+		// Executes function(index) for every index in [begin, end). The range is split into chunks of grain 
+		// indices (a grain of 0 picks one based on the worker count, ranges smaller than PARALLEL_MIN_GRAIN then
+		// run on the calling thread). Returns when all chunks have completed.
+		template <typename Function>
+		void ParallelFor(unsigned int begin, unsigned int end, unsigned int grain, Function&& function)
+		{
+			ParallelForRange(begin, end, grain, [&function](unsigned int chunkBegin, unsigned int chunkEnd)
+			{
+				for (unsigned int i = chunkBegin; i < chunkEnd; i++)
+				{
+					function(i);
+				}
+			});
+		}
 
-		// Add a task
+		// Same as ParallelFor() but the function is invoked once per chunk, as function(chunkBegin, chunkEnd)
 		template <typename Function>
-		void AddTask(Function&& function)
+		void ParallelForRange(unsigned int begin, unsigned int end, unsigned int grain, Function&& function)
 		{
-			// Lock tasks mutex
-			std::unique_lock<std::mutex> lock(m_tasksMutex);
+			if (end <= begin)
+				return;
 
-			// Save the task
-			m_tasks.push(std::make_shared<Task>(std::bind(std::forward<Function>(function))));
+			grain = ComputeGrain(end - begin, grain);
 
-			// Unlock the mutex
-			lock.unlock();
+			TaskHandle handle;
+			unsigned int chunkBegin = begin;
+			while (end - chunkBegin > grain)
+			{
+				unsigned int chunkEnd = chunkBegin + grain;
+				AddTask([&function, chunkBegin, chunkEnd]() { function(chunkBegin, chunkEnd); }, handle);
+				chunkBegin = chunkEnd;
+			}
 
-			// Wake up a thread
-			m_conditionVar.notify_one();
+			// The calling thread takes the last chunk and then helps with the rest
+			function(chunkBegin, end);
+			Wait(handle);
 		}
 
+		// Maps every chunk of [begin, end) to a value via map(chunkBegin, chunkEnd) and
+		// combines the results (in chunk order) via reduce(a, b), starting from identity.
+		template <typename T, typename Map, typename Reduce>
+		T ParallelReduce(unsigned int begin, unsigned int end, unsigned int grain, const T& identity, Map&& map, Reduce&& reduce)
+		{
+			if (end <= begin)
+				return identity;
+
+			grain = ComputeGrain(end - begin, grain);
+
+			// Wrapped so that every chunk writes to its own object (even for T = bool)
+			struct ChunkResult { T value; };
+			unsigned int chunkCount = (end - begin + grain - 1) / grain;
+			std::vector<ChunkResult> results(chunkCount, ChunkResult{ identity });
+
+			ParallelFor(0, chunkCount, 1, [&](unsigned int chunk)
+			{
+				unsigned int chunkBegin	= begin + chunk * grain;
+				unsigned int chunkEnd	= end - chunkBegin > grain ? chunkBegin + grain : end;
+				results[chunk].value	= map(chunkBegin, chunkEnd);
+			});
+
+			T result = identity;
+			for (const auto& chunkResult : results)
+			{
+				result = reduce(result, chunkResult.value);
+			}
+
+			return result;
+		}
+		//========================================================================================================
+
+		unsigned int GetWorkerCount() { return (unsigned int)m_threads.size(); }
+
 	private:
-		int m_threadCount = 7;
+		void Schedule(Task&& task);
+		bool TryGetTask(Task& task, int workerIndex);
+		bool TryGetTask(Task& task, const TaskCounter* counter);
+
+		// Returns the user defined grain, or one that yields a few chunks per thread (but no tiny ones)
+		unsigned int ComputeGrain(unsigned int count, unsigned int grain)
+		{
+			if (grain != 0)
+				return grain;
+
+			unsigned int chunkCount = (GetWorkerCount() + 1) * 4;
+			grain					= (count + chunkCount - 1) / chunkCount;
+			return grain > PARALLEL_MIN_GRAIN ? grain : PARALLEL_MIN_GRAIN;
+		}
+
+		unsigned int m_threadCount;
 		std::vector<std::thread> m_threads;
-		std::queue<std::shared_ptr<Task>> m_tasks;
-		std::mutex m_tasksMutex;
+		std::vector<std::unique_ptr<TaskQueue>> m_queues;
+		std::atomic<unsigned int> m_queueNext	= 0;
+		std::atomic<int> m_tasksQueued			= 0;
+		std::atomic<int> m_threadsSleeping		= 0;
+		std::mutex m_sleepMutex;
 		std::condition_variable m_conditionVar;
 		bool m_stopping;
 	};